@@ -0,0 +1,770 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "AudioExpression.h"
+#include "AudioUtils.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace DSPProcessing
+{
+	namespace AudioExpressionPrivate
+	{
+		using EOpCode = FAudioExpression::EOpCode;
+
+		// Register ids used while compiling, remapped to the final layout once the constant count is known
+		constexpr int32 ConstantIdBase = 1000;
+		constexpr int32 TemporaryIdBase = 2000;
+
+		struct FOperand
+		{
+			bool bIsConstant = true;
+			float Value = 0.0f;
+			int32 Register = INDEX_NONE;
+		};
+
+		struct FPendingInstruction
+		{
+			EOpCode OpCode;
+			int32 Dest;
+			int32 A;
+			int32 B;
+		};
+
+		struct FFunctionInfo
+		{
+			const TCHAR* Name;
+			EOpCode OpCode;
+			int32 NumArgs;
+		};
+
+		static const FFunctionInfo Functions[] =
+		{
+			{ TEXT("sin"), EOpCode::Sin, 1 },
+			{ TEXT("cos"), EOpCode::Cos, 1 },
+			{ TEXT("sqrt"), EOpCode::Sqrt, 1 },
+			{ TEXT("pow"), EOpCode::Pow, 2 },
+			{ TEXT("wrap"), EOpCode::Wrap, 1 },
+			{ TEXT("gate"), EOpCode::Gate, 2 },
+			{ TEXT("abs"), EOpCode::Abs, 1 },
+			{ TEXT("min"), EOpCode::Min, 2 },
+			{ TEXT("max"), EOpCode::Max, 2 },
+		};
+
+		static const TCHAR* InputNames[FAudioExpression::MaxInputs] = { TEXT("x"), TEXT("y"), TEXT("z"), TEXT("w") };
+		static const TCHAR* StateNames[FAudioExpression::MaxStates] = { TEXT("s0"), TEXT("s1"), TEXT("s2"), TEXT("s3") };
+
+		struct FStateAssignment
+		{
+			int32 StateIndex;
+			FOperand Value;
+		};
+
+		// Recursive descent parser that emits bytecode as it goes, folding constant sub-expressions.
+		class FCompiler
+		{
+		public:
+			FCompiler(const FString& InExpression, const bool bInAllowState)
+				: Source(InExpression)
+				, Text(*InExpression)
+				, Length(InExpression.Len())
+				, bAllowState(bInAllowState)
+			{
+			}
+
+			bool Compile(FString& OutError)
+			{
+				TArray<FStateAssignment> Assignments;
+				while (!bHasError && bAllowState)
+				{
+					const int32 StateIndex = MatchStateAssignment();
+					if (StateIndex == INDEX_NONE)
+					{
+						break;
+					}
+
+					FStateAssignment Assignment = { StateIndex, ParseExpression() };
+					if (!Assignment.Value.bIsConstant && Assignment.Value.Register >= FAudioExpression::FirstStateRegister && Assignment.Value.Register < FAudioExpression::FirstStateRegister + FAudioExpression::MaxStates)
+					{
+						// snapshot state reads, an earlier commit could overwrite them before this one lands
+						Assignment.Value = Emit(EOpCode::Copy, Assignment.Value, Assignment.Value);
+					}
+					Assignments.Add(Assignment);
+					Expect(TEXT(";"));
+				}
+
+				FOperand Result = ParseExpression();
+				SkipWhitespace();
+
+				if (!bHasError && Position < Length)
+				{
+					SetError(TEXT("unexpected character"));
+				}
+
+				if (bHasError)
+				{
+					OutError = Error;
+					return false;
+				}
+
+				if (!Result.bIsConstant && Result.Register >= TemporaryIdBase && Instructions.Num() > 0 && Instructions.Last().Dest == Result.Register)
+				{
+					// the last instruction produced the result, let it write straight to the output
+					Instructions.Last().Dest = FAudioExpression::OutputRegister;
+				}
+				else
+				{
+					const int32 ResultRegister = Materialize(Result);
+					Instructions.Add({ EOpCode::Copy, FAudioExpression::OutputRegister, ResultRegister, ResultRegister });
+				}
+
+				// state only changes once the output is known, so every read inside the program sees z^-1
+				for (const FStateAssignment& Assignment : Assignments)
+				{
+					const int32 ValueRegister = Materialize(Assignment.Value);
+					Instructions.Add({ EOpCode::Copy, FAudioExpression::FirstStateRegister + Assignment.StateIndex, ValueRegister, ValueRegister });
+					Release(Assignment.Value);
+				}
+
+				const int32 NumRegisters = FAudioExpression::FirstConstantRegister + Constants.Num() + NumTemporaries;
+				if (NumRegisters > FAudioExpression::MaxRegisters)
+				{
+					OutError = TEXT("expression is too large");
+					return false;
+				}
+
+				return true;
+			}
+
+			uint8 Remap(const int32 InRegister) const
+			{
+				if (InRegister >= TemporaryIdBase)
+				{
+					return (uint8)(FAudioExpression::FirstConstantRegister + Constants.Num() + InRegister - TemporaryIdBase);
+				}
+				if (InRegister >= ConstantIdBase)
+				{
+					return (uint8)(FAudioExpression::FirstConstantRegister + InRegister - ConstantIdBase);
+				}
+				return (uint8)InRegister;
+			}
+
+			TArray<FPendingInstruction> Instructions;
+			TArray<float> Constants;
+			int32 NumTemporaries = 0;
+
+		private:
+			FOperand ParseExpression()
+			{
+				FOperand Left = ParseAdditive();
+
+				while (!bHasError)
+				{
+					EOpCode OpCode;
+					if (Match(TEXT("<=")))
+					{
+						OpCode = EOpCode::LessEqual;
+					}
+					else if (Match(TEXT(">=")))
+					{
+						OpCode = EOpCode::GreaterEqual;
+					}
+					else if (Match(TEXT("==")))
+					{
+						OpCode = EOpCode::Equal;
+					}
+					else if (Match(TEXT("!=")))
+					{
+						OpCode = EOpCode::NotEqual;
+					}
+					else if (Match(TEXT("<")))
+					{
+						OpCode = EOpCode::Less;
+					}
+					else if (Match(TEXT(">")))
+					{
+						OpCode = EOpCode::Greater;
+					}
+					else
+					{
+						break;
+					}
+
+					FOperand Right = ParseAdditive();
+					Left = Emit(OpCode, Left, Right);
+				}
+
+				return Left;
+			}
+
+			FOperand ParseAdditive()
+			{
+				FOperand Left = ParseTerm();
+
+				while (!bHasError)
+				{
+					EOpCode OpCode;
+					if (Match(TEXT("+")))
+					{
+						OpCode = EOpCode::Add;
+					}
+					else if (Match(TEXT("-")))
+					{
+						OpCode = EOpCode::Subtract;
+					}
+					else
+					{
+						break;
+					}
+
+					FOperand Right = ParseTerm();
+					Left = Emit(OpCode, Left, Right);
+				}
+
+				return Left;
+			}
+
+			FOperand ParseTerm()
+			{
+				FOperand Left = ParseUnary();
+
+				while (!bHasError)
+				{
+					EOpCode OpCode;
+					if (Match(TEXT("*")))
+					{
+						OpCode = EOpCode::Multiply;
+					}
+					else if (Match(TEXT("/")))
+					{
+						OpCode = EOpCode::Divide;
+					}
+					else
+					{
+						break;
+					}
+
+					FOperand Right = ParseUnary();
+					Left = Emit(OpCode, Left, Right);
+				}
+
+				return Left;
+			}
+
+			FOperand ParseUnary()
+			{
+				if (Match(TEXT("-")))
+				{
+					FOperand Operand = ParseUnary();
+					return Emit(EOpCode::Negate, Operand, Operand);
+				}
+
+				Match(TEXT("+"));
+				return ParsePrimary();
+			}
+
+			FOperand ParsePrimary()
+			{
+				SkipWhitespace();
+
+				if (Position >= Length)
+				{
+					SetError(TEXT("unexpected end of expression"));
+					return FOperand();
+				}
+
+				if (Match(TEXT("(")))
+				{
+					FOperand Operand = ParseExpression();
+					Expect(TEXT(")"));
+					return Operand;
+				}
+
+				const TCHAR Character = Text[Position];
+				if (FChar::IsDigit(Character) || Character == TEXT('.'))
+				{
+					return ParseNumber();
+				}
+
+				if (FChar::IsAlpha(Character) || Character == TEXT('_'))
+				{
+					return ParseIdentifier();
+				}
+
+				SetError(TEXT("unexpected character"));
+				return FOperand();
+			}
+
+			FOperand ParseNumber()
+			{
+				const int32 Start = Position;
+				while (Position < Length && (FChar::IsDigit(Text[Position]) || Text[Position] == TEXT('.')))
+				{
+					++Position;
+				}
+
+				if (Position < Length && (Text[Position] == TEXT('e') || Text[Position] == TEXT('E')))
+				{
+					++Position;
+					if (Position < Length && (Text[Position] == TEXT('-') || Text[Position] == TEXT('+')))
+					{
+						++Position;
+					}
+					while (Position < Length && FChar::IsDigit(Text[Position]))
+					{
+						++Position;
+					}
+				}
+
+				FOperand Operand;
+				Operand.Value = FCString::Atof(*Source.Mid(Start, Position - Start));
+				return Operand;
+			}
+
+			FOperand ParseIdentifier()
+			{
+				const int32 Start = Position;
+				while (Position < Length && FChar::IsIdentifier(Text[Position]))
+				{
+					++Position;
+				}
+				const FString Name = Source.Mid(Start, Position - Start);
+
+				for (int32 InputIndex = 0; InputIndex < FAudioExpression::MaxInputs; ++InputIndex)
+				{
+					if (Name == InputNames[InputIndex])
+					{
+						FOperand Operand;
+						Operand.bIsConstant = false;
+						Operand.Register = InputIndex;
+						return Operand;
+					}
+				}
+
+				for (int32 StateIndex = 0; StateIndex < FAudioExpression::MaxStates; ++StateIndex)
+				{
+					if (Name == StateNames[StateIndex])
+					{
+						if (!bAllowState)
+						{
+							SetError(TEXT("state registers are only available in the Feedback Expr node"));
+							return FOperand();
+						}
+
+						FOperand Operand;
+						Operand.bIsConstant = false;
+						Operand.Register = FAudioExpression::FirstStateRegister + StateIndex;
+						return Operand;
+					}
+				}
+
+				if (Name == TEXT("pi"))
+				{
+					FOperand Operand;
+					Operand.Value = PI;
+					return Operand;
+				}
+
+				for (const FFunctionInfo& Function : Functions)
+				{
+					if (Name == Function.Name)
+					{
+						Expect(TEXT("("));
+						FOperand A = ParseExpression();
+						FOperand B = A;
+						if (Function.NumArgs == 2)
+						{
+							Expect(TEXT(","));
+							B = ParseExpression();
+						}
+						Expect(TEXT(")"));
+
+						return Emit(Function.OpCode, A, B);
+					}
+				}
+
+				SetError(FString::Printf(TEXT("unknown name '%s'"), *Name));
+				return FOperand();
+			}
+
+			FOperand Emit(const EOpCode InOpCode, const FOperand& A, const FOperand& B)
+			{
+				if (bHasError)
+				{
+					return FOperand();
+				}
+
+				// unary ops pass A twice, so they fold and release the same way
+				if (A.bIsConstant && B.bIsConstant)
+				{
+					FOperand Folded;
+					Folded.Value = FAudioExpression::EvaluateScalar(InOpCode, A.Value, B.Value);
+					return Folded;
+				}
+
+				const int32 RegisterA = Materialize(A);
+				const int32 RegisterB = Materialize(B);
+				Release(A);
+				Release(B);
+
+				FOperand Result;
+				Result.bIsConstant = false;
+				Result.Register = AllocateTemporary();
+				Instructions.Add({ InOpCode, Result.Register, RegisterA, RegisterB });
+
+				return Result;
+			}
+
+			int32 Materialize(const FOperand& InOperand)
+			{
+				if (!InOperand.bIsConstant)
+				{
+					return InOperand.Register;
+				}
+
+				int32 ConstantIndex = Constants.IndexOfByKey(InOperand.Value);
+				if (ConstantIndex == INDEX_NONE)
+				{
+					ConstantIndex = Constants.Add(InOperand.Value);
+				}
+				return ConstantIdBase + ConstantIndex;
+			}
+
+			int32 AllocateTemporary()
+			{
+				int32 TemporaryIndex = TemporaryInUse.Find(false);
+				if (TemporaryIndex == INDEX_NONE)
+				{
+					TemporaryIndex = TemporaryInUse.Add(true);
+				}
+				TemporaryInUse[TemporaryIndex] = true;
+				NumTemporaries = FMath::Max(NumTemporaries, TemporaryIndex + 1);
+
+				return TemporaryIdBase + TemporaryIndex;
+			}
+
+			void Release(const FOperand& InOperand)
+			{
+				if (!InOperand.bIsConstant && InOperand.Register >= TemporaryIdBase)
+				{
+					TemporaryInUse[InOperand.Register - TemporaryIdBase] = false;
+				}
+			}
+
+			// Consumes "sN =" and returns N, or leaves the position untouched and returns INDEX_NONE.
+			int32 MatchStateAssignment()
+			{
+				const int32 Start = Position;
+				SkipWhitespace();
+
+				for (int32 StateIndex = 0; StateIndex < FAudioExpression::MaxStates; ++StateIndex)
+				{
+					const int32 NameLength = FCString::Strlen(StateNames[StateIndex]);
+					const bool bNameEnds = Position + NameLength >= Length || !FChar::IsIdentifier(Text[Position + NameLength]);
+					if (bNameEnds && Match(StateNames[StateIndex]))
+					{
+						if (Match(TEXT("=")) && !Match(TEXT("=")))
+						{
+							return StateIndex;
+						}
+						break;
+					}
+				}
+
+				Position = Start;
+				return INDEX_NONE;
+			}
+
+			void SkipWhitespace()
+			{
+				while (Position < Length && FChar::IsWhitespace(Text[Position]))
+				{
+					++Position;
+				}
+			}
+
+			bool Match(const TCHAR* InToken)
+			{
+				SkipWhitespace();
+
+				const int32 TokenLength = FCString::Strlen(InToken);
+				if (Position + TokenLength <= Length && FCString::Strncmp(&Text[Position], InToken, TokenLength) == 0)
+				{
+					Position += TokenLength;
+					return true;
+				}
+				return false;
+			}
+
+			void Expect(const TCHAR* InToken)
+			{
+				if (!bHasError && !Match(InToken))
+				{
+					SetError(FString::Printf(TEXT("expected '%s'"), InToken));
+				}
+			}
+
+			void SetError(const FString& InError)
+			{
+				if (!bHasError)
+				{
+					bHasError = true;
+					Error = FString::Printf(TEXT("%s at column %d"), *InError, Position + 1);
+				}
+			}
+
+			const FString& Source;
+			const TCHAR* Text;
+			int32 Length;
+			int32 Position = 0;
+			bool bAllowState;
+
+			TArray<bool> TemporaryInUse;
+
+			bool bHasError = false;
+			FString Error;
+		};
+	} // namespace AudioExpressionPrivate
+
+	bool FAudioExpression::Compile(const FString& InExpression, FString& OutError, const bool bInAllowState)
+	{
+		using namespace AudioExpressionPrivate;
+
+		Program.Reset();
+		ConstantValues.Reset();
+		NumTemporaries = 0;
+
+		FCompiler Compiler(InExpression, bInAllowState);
+		if (!Compiler.Compile(OutError))
+		{
+			return false;
+		}
+
+		for (const FPendingInstruction& Pending : Compiler.Instructions)
+		{
+			Program.Add({ Pending.OpCode, Compiler.Remap(Pending.Dest), Compiler.Remap(Pending.A), Compiler.Remap(Pending.B) });
+		}
+		ConstantValues = Compiler.Constants;
+		NumTemporaries = Compiler.NumTemporaries;
+
+		// constants are splatted once here so every op can treat its operands as plain buffers
+		const int32 NumMemoryRegisters = ConstantValues.Num() + NumTemporaries;
+		RegisterMemory.SetNumZeroed(NumMemoryRegisters * ChunkSize);
+		for (int32 ConstantIndex = 0; ConstantIndex < ConstantValues.Num(); ++ConstantIndex)
+		{
+			float* ConstantData = &RegisterMemory[ConstantIndex * ChunkSize];
+			for (int32 Index = 0; Index < ChunkSize; ++Index)
+			{
+				ConstantData[Index] = ConstantValues[ConstantIndex];
+			}
+		}
+
+		Registers.SetNumZeroed(FirstConstantRegister + NumMemoryRegisters);
+		for (int32 RegisterIndex = 0; RegisterIndex < NumMemoryRegisters; ++RegisterIndex)
+		{
+			Registers[FirstConstantRegister + RegisterIndex] = &RegisterMemory[RegisterIndex * ChunkSize];
+		}
+
+		ScalarRegisters.SetNumZeroed(FirstConstantRegister + NumMemoryRegisters);
+		for (int32 ConstantIndex = 0; ConstantIndex < ConstantValues.Num(); ++ConstantIndex)
+		{
+			ScalarRegisters[FirstConstantRegister + ConstantIndex] = ConstantValues[ConstantIndex];
+		}
+
+		return true;
+	}
+
+	void FAudioExpression::ProcessAudioBuffer(const float* const* InBuffers, float* OutBuffer, const int32 InNumSamples)
+	{
+		if (!IsValid())
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
+		}
+
+		for (int32 Offset = 0; Offset < InNumSamples; Offset += ChunkSize)
+		{
+			ProcessChunk(InBuffers, OutBuffer, Offset, FMath::Min(ChunkSize, InNumSamples - Offset));
+		}
+	}
+
+	void FAudioExpression::ProcessAudioBufferPerSample(const float* const* InBuffers, float* OutBuffer, const int32 InNumSamples)
+	{
+		if (!IsValid())
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
+		}
+
+		float* Values = ScalarRegisters.GetData();
+
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			for (int32 InputIndex = 0; InputIndex < MaxInputs; ++InputIndex)
+			{
+				Values[InputIndex] = InBuffers[InputIndex][Index];
+			}
+
+			for (const FInstruction& Instruction : Program)
+			{
+				Values[Instruction.Dest] = EvaluateScalar(Instruction.OpCode, Values[Instruction.A], Values[Instruction.B]);
+			}
+
+			OutBuffer[Index] = Values[OutputRegister];
+		}
+
+		for (int32 StateIndex = 0; StateIndex < MaxStates; ++StateIndex)
+		{
+			float& State = Values[FirstStateRegister + StateIndex];
+			State = FlushDenormalToZero(State);
+
+			// an unstable recursion would otherwise stay stuck on NaN/Inf
+			if (!FMath::IsFinite(State))
+			{
+				Reset();
+				break;
+			}
+		}
+	}
+
+	void FAudioExpression::Reset()
+	{
+		for (int32 StateIndex = 0; StateIndex < MaxStates && FirstStateRegister + StateIndex < ScalarRegisters.Num(); ++StateIndex)
+		{
+			ScalarRegisters[FirstStateRegister + StateIndex] = 0.0f;
+		}
+	}
+
+	void FAudioExpression::ProcessChunk(const float* const* InBuffers, float* OutBuffer, const int32 InOffset, const int32 InNumSamples)
+	{
+		// inputs are never a destination, so dropping const here is safe
+		for (int32 InputIndex = 0; InputIndex < MaxInputs; ++InputIndex)
+		{
+			Registers[InputIndex] = const_cast<float*>(InBuffers[InputIndex]) + InOffset;
+		}
+		Registers[OutputRegister] = OutBuffer + InOffset;
+
+		for (const FInstruction& Instruction : Program)
+		{
+			float* Dest = Registers[Instruction.Dest];
+			const float* A = Registers[Instruction.A];
+			const float* B = Registers[Instruction.B];
+
+			switch (Instruction.OpCode)
+			{
+			case EOpCode::Copy:
+				FMemory::Memcpy(Dest, A, InNumSamples * sizeof(float));
+				break;
+
+			case EOpCode::Negate:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = -A[Index];
+				break;
+
+			case EOpCode::Add:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] + B[Index];
+				break;
+
+			case EOpCode::Subtract:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] - B[Index];
+				break;
+
+			case EOpCode::Multiply:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] * B[Index];
+				break;
+
+			case EOpCode::Divide:
+				FAudioDivide().ProcessAudioBuffer(A, Dest, B, InNumSamples);
+				break;
+
+			case EOpCode::Less:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] < B[Index];
+				break;
+
+			case EOpCode::Greater:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] > B[Index];
+				break;
+
+			case EOpCode::LessEqual:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] <= B[Index];
+				break;
+
+			case EOpCode::GreaterEqual:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] >= B[Index];
+				break;
+
+			case EOpCode::Equal:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] == B[Index];
+				break;
+
+			case EOpCode::NotEqual:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = A[Index] != B[Index];
+				break;
+
+			case EOpCode::Sin:
+				FSine().ProcessAudioBuffer(A, Dest, InNumSamples);
+				break;
+
+			case EOpCode::Cos:
+				FCos().ProcessAudioBuffer(A, Dest, InNumSamples);
+				break;
+
+			case EOpCode::Sqrt:
+				FSqrt().ProcessAudioBuffer(A, Dest, InNumSamples);
+				break;
+
+			case EOpCode::Pow:
+				FPow().ProcessAudioBuffer(A, Dest, B, InNumSamples);
+				break;
+
+			case EOpCode::Wrap:
+				FWrap().ProcessAudioBuffer(A, Dest, InNumSamples);
+				break;
+
+			case EOpCode::Gate:
+				FGate().ProcessAudioBuffer(A, Dest, B, InNumSamples);
+				break;
+
+			case EOpCode::Abs:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = FMath::Abs(A[Index]);
+				break;
+
+			case EOpCode::Min:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = FMath::Min(A[Index], B[Index]);
+				break;
+
+			case EOpCode::Max:
+				for (int32 Index = 0; Index < InNumSamples; ++Index) Dest[Index] = FMath::Max(A[Index], B[Index]);
+				break;
+			}
+		}
+	}
+
+	float FAudioExpression::EvaluateScalar(const EOpCode InOpCode, const float A, const float B)
+	{
+		switch (InOpCode)
+		{
+		case EOpCode::Copy:			return A;
+		case EOpCode::Negate:		return -A;
+		case EOpCode::Add:			return A + B;
+		case EOpCode::Subtract:		return A - B;
+		case EOpCode::Multiply:		return A * B;
+		case EOpCode::Divide:		return B == 0.0f ? 0.0f : A / B;
+		case EOpCode::Less:			return A < B;
+		case EOpCode::Greater:		return A > B;
+		case EOpCode::LessEqual:	return A <= B;
+		case EOpCode::GreaterEqual:	return A >= B;
+		case EOpCode::Equal:		return A == B;
+		case EOpCode::NotEqual:		return A != B;
+		case EOpCode::Sin:			return FMath::Sin((2.0f * PI) * A);
+		case EOpCode::Cos:			return FMath::Cos((2.0f * PI) * A);
+		case EOpCode::Sqrt:			return (A < 0 ? -1 : 1) * FMath::Sqrt(FMath::Abs(A));
+		case EOpCode::Pow:			return (A < 0.0f ? -1.0f : 1.0f) * FMath::Pow(FMath::Abs(A), B);
+		case EOpCode::Wrap:			return sWrap(A);
+		case EOpCode::Gate:			return FMath::RoundHalfFromZero(B) != 0.0f ? A : 0.0f;
+		case EOpCode::Abs:			return FMath::Abs(A);
+		case EOpCode::Min:			return FMath::Min(A, B);
+		case EOpCode::Max:			return FMath::Max(A, B);
+		}
+
+		return 0.0f;
+	}
+} // namespace DSPProcessing
@@ -0,0 +1,64 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "AudioMathEventChannels.h"
+#include "Misc/ScopeLock.h"
+#include "MetasoundsAudioMathUtils.h"
+
+namespace Metasound
+{
+	namespace AudioMathEventChannelsPrivate
+	{
+		FCriticalSection RegistryCriticalSection;
+		TMap<FName, FTimerEventChannelPtr> TimerChannels;
+		TMap<FName, FProbeEventChannelPtr> ProbeChannels;
+
+		template<typename ChannelType>
+		TSharedPtr<ChannelType, ESPMode::ThreadSafe> FindOrAdd(TMap<FName, TSharedPtr<ChannelType, ESPMode::ThreadSafe>>& InOutChannels, const FName InName)
+		{
+			FScopeLock Lock(&RegistryCriticalSection);
+
+			if (TSharedPtr<ChannelType, ESPMode::ThreadSafe>* ExistingChannel = InOutChannels.Find(InName))
+			{
+				return *ExistingChannel;
+			}
+
+			TSharedPtr<ChannelType, ESPMode::ThreadSafe> Channel = MakeShared<ChannelType, ESPMode::ThreadSafe>(FAudioMathEventChannels::ChannelCapacity);
+			InOutChannels.Add(InName, Channel);
+
+			return Channel;
+		}
+
+		template<typename ElementType>
+		TAudioMathEventWriter<ElementType> Claim(TMap<FName, TSharedPtr<TAudioMathEventChannel<ElementType>, ESPMode::ThreadSafe>>& InOutChannels, const FName InName)
+		{
+			TAudioMathEventWriter<ElementType> Writer(FindOrAdd(InOutChannels, InName));
+			if (!Writer.IsValid())
+			{
+				UE_LOG(LogMetasoundsAudioMathUtils, Warning, TEXT("Event channel '%s' already has a writing node, this one will not publish to it."), *InName.ToString());
+			}
+
+			return Writer;
+		}
+	}
+
+	FTimerEventChannelPtr FAudioMathEventChannels::FindOrAddTimerChannel(const FName InName)
+	{
+		return AudioMathEventChannelsPrivate::FindOrAdd(AudioMathEventChannelsPrivate::TimerChannels, InName);
+	}
+
+	FProbeEventChannelPtr FAudioMathEventChannels::FindOrAddProbeChannel(const FName InName)
+	{
+		return AudioMathEventChannelsPrivate::FindOrAdd(AudioMathEventChannelsPrivate::ProbeChannels, InName);
+	}
+
+	FTimerEventWriter FAudioMathEventChannels::ClaimTimerWriter(const FName InName)
+	{
+		return AudioMathEventChannelsPrivate::Claim(AudioMathEventChannelsPrivate::TimerChannels, InName);
+	}
+
+	FProbeEventWriter FAudioMathEventChannels::ClaimProbeWriter(const FName InName)
+	{
+		return AudioMathEventChannelsPrivate::Claim(AudioMathEventChannelsPrivate::ProbeChannels, InName);
+	}
+}
@@ -3,99 +3,1159 @@
 
 
 #include "AudioUtils.h"
+#include "AudioMathKernels.h"
 #include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "MetasoundsAudioMathUtils.h"
+
+#include <atomic>
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+static int32 SanitizeNonFiniteCVar = 0;
+static FAutoConsoleVariableRef CVarSanitizeNonFinite(
+	TEXT("au.MetasoundsAudioMathUtils.SanitizeNonFinite"),
+	SanitizeNonFiniteCVar,
+	TEXT("Checks the output of math nodes for NaN/Inf once per block.\n")
+	TEXT("0: Off, 1: Zero non-finite samples and reset the node's state, 2: As 1, and log (at most once a second)"),
+	ECVF_Default);
+#endif
 
 namespace DSPProcessing
 {
-	void FAudioDivide::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputAudioDivide, const int32 InNumSamples)
+	bool IsBufferSilent(const float* InBuffer, const int32 InNumSamples)
+	{
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		const VectorRegister4Float Zero = VectorZeroFloat();
+
+		// bail on the first non-zero group of four, so audible blocks only pay for their leading samples
+		for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+		{
+			if (VectorMaskBits(VectorCompareNE(VectorLoad(&InBuffer[Index]), Zero)))
+			{
+				return false;
+			}
+		}
+
+		for (int32 Index = NumVectorSamples; Index < InNumSamples; ++Index)
+		{
+			if (InBuffer[Index] != 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool IsBufferUniform(const float* InBuffer, const int32 InNumSamples)
+	{
+		if (InNumSamples <= 0)
+		{
+			return true;
+		}
+
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		const VectorRegister4Float First = VectorLoadFloat1(InBuffer);
+
+		for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+		{
+			if (VectorMaskBits(VectorCompareNE(VectorLoad(&InBuffer[Index]), First)))
+			{
+				return false;
+			}
+		}
+
+		for (int32 Index = NumVectorSamples; Index < InNumSamples; ++Index)
+		{
+			if (InBuffer[Index] != InBuffer[0])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	FBlockStats ComputeBlockStats(const float* InBuffer, const int32 InNumSamples)
+	{
+		FBlockStats Stats;
+		if (InNumSamples <= 0)
+		{
+			return Stats;
+		}
+
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		int32 Index = 0;
+
+		if (NumVectorSamples > 0)
+		{
+			VectorRegister4Float Min = VectorLoad(InBuffer);
+			VectorRegister4Float Max = Min;
+			VectorRegister4Float SumOfSquares = VectorMultiply(Min, Min);
+
+			for (Index = 4; Index < NumVectorSamples; Index += 4)
+			{
+				const VectorRegister4Float Samples = VectorLoad(&InBuffer[Index]);
+				Min = VectorMin(Min, Samples);
+				Max = VectorMax(Max, Samples);
+				SumOfSquares = VectorMultiplyAdd(Samples, Samples, SumOfSquares);
+			}
+
+			alignas(16) float Lanes[3][4];
+			VectorStoreAligned(Min, Lanes[0]);
+			VectorStoreAligned(Max, Lanes[1]);
+			VectorStoreAligned(SumOfSquares, Lanes[2]);
+
+			Stats.Min = FMath::Min(FMath::Min(Lanes[0][0], Lanes[0][1]), FMath::Min(Lanes[0][2], Lanes[0][3]));
+			Stats.Max = FMath::Max(FMath::Max(Lanes[1][0], Lanes[1][1]), FMath::Max(Lanes[1][2], Lanes[1][3]));
+			Stats.SumOfSquares = (Lanes[2][0] + Lanes[2][1]) + (Lanes[2][2] + Lanes[2][3]);
+		}
+		else
+		{
+			Stats.Min = InBuffer[0];
+			Stats.Max = InBuffer[0];
+		}
+
+		for (; Index < InNumSamples; ++Index)
+		{
+			const float Sample = InBuffer[Index];
+			Stats.Min = FMath::Min(Stats.Min, Sample);
+			Stats.Max = FMath::Max(Stats.Max, Sample);
+			Stats.SumOfSquares += Sample * Sample;
+		}
+
+		return Stats;
+	}
+
+	int32 DecimatePeaks(const float* InBuffer, const int32 InNumSamples, const int32 InStride, float* OutPoints)
+	{
+		const int32 Stride = FMath::Max(InStride, 1);
+		int32 NumPoints = 0;
+
+		for (int32 Start = 0; Start < InNumSamples; Start += Stride)
+		{
+			const int32 End = FMath::Min(Start + Stride, InNumSamples);
+
+			float Peak = InBuffer[Start];
+			for (int32 Index = Start + 1; Index < End; ++Index)
+			{
+				if (FMath::Abs(InBuffer[Index]) > FMath::Abs(Peak))
+				{
+					Peak = InBuffer[Index];
+				}
+			}
+
+			OutPoints[NumPoints++] = Peak;
+		}
+
+		return NumPoints;
+	}
+
+	void ConvolveValid(const float* RESTRICT InSignal, const float* RESTRICT InTaps, const int32 InNumTaps, float* RESTRICT OutBuffer, const int32 InNumOutput)
+	{
+		const int32 NumVectorOutput = InNumOutput & ~3;
+		int32 Index = 0;
+
+		// each tap is broadcast against four neighbouring windows, so every load is used by four outputs
+		for (; Index < NumVectorOutput; Index += 4)
+		{
+			VectorRegister4Float Sum = VectorZeroFloat();
+			for (int32 Tap = 0; Tap < InNumTaps; ++Tap)
+			{
+				Sum = VectorMultiplyAdd(VectorLoadFloat1(&InTaps[Tap]), VectorLoad(&InSignal[Index + Tap]), Sum);
+			}
+			VectorStore(Sum, &OutBuffer[Index]);
+		}
+
+		for (; Index < InNumOutput; ++Index)
+		{
+			float Sum = 0.0f;
+			for (int32 Tap = 0; Tap < InNumTaps; ++Tap)
+			{
+				Sum += InTaps[Tap] * InSignal[Index + Tap];
+			}
+			OutBuffer[Index] = Sum;
+		}
+	}
+
+	void ComplexMultiplyAdd(const float* RESTRICT InA, const float* RESTRICT InB, float* RESTRICT InOutAccumulator, const int32 InNumFloats)
+	{
+		checkSlow((InNumFloats & 3) == 0);
+
+		// (ar + i ai)(br + i bi) = (ar br - ai bi) + i (ar bi + ai br), two bins per vector
+		const VectorRegister4Float SignFlip = MakeVectorRegisterFloat(-1.0f, 1.0f, -1.0f, 1.0f);
+
+		for (int32 Index = 0; Index < InNumFloats; Index += 4)
+		{
+			const VectorRegister4Float A = VectorLoadAligned(&InA[Index]);
+			const VectorRegister4Float B = VectorLoadAligned(&InB[Index]);
+
+			const VectorRegister4Float ARe = VectorSwizzle(A, 0, 0, 2, 2);
+			const VectorRegister4Float AIm = VectorMultiply(VectorSwizzle(A, 1, 1, 3, 3), SignFlip);
+			const VectorRegister4Float BSwapped = VectorSwizzle(B, 1, 0, 3, 2);
+
+			VectorRegister4Float Accumulator = VectorLoadAligned(&InOutAccumulator[Index]);
+			Accumulator = VectorMultiplyAdd(ARe, B, Accumulator);
+			Accumulator = VectorMultiplyAdd(AIm, BSwapped, Accumulator);
+			VectorStoreAligned(Accumulator, &InOutAccumulator[Index]);
+		}
+	}
+
+	void FInputBlockCache::Init(const int32 InNumSamples)
+	{
+		mPreviousBlock.SetNumUninitialized(InNumSamples);
+		bIsValid = false;
+	}
+
+	bool FInputBlockCache::MatchesPrevious(const float* InBuffer, const int32 InNumSamples)
+	{
+		const int32 NumBytes = InNumSamples * sizeof(float);
+		if (bIsValid && mPreviousBlock.Num() == InNumSamples && FMemory::Memcmp(mPreviousBlock.GetData(), InBuffer, NumBytes) == 0)
+		{
+			return true;
+		}
+
+		// sized by Init, so this only allocates if the operator never called it
+		if (mPreviousBlock.Num() != InNumSamples)
+		{
+			mPreviousBlock.SetNumUninitialized(InNumSamples);
+		}
+
+		FMemory::Memcpy(mPreviousBlock.GetData(), InBuffer, NumBytes);
+		bIsValid = true;
+
+		return false;
+	}
+
+	void FInputBlockCache::Invalidate()
+	{
+		bIsValid = false;
+	}
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+	bool SanitizeNonFinite(float* InOutBuffer, const int32 InNumSamples, const TCHAR* InNodeName)
 	{
+		if (SanitizeNonFiniteCVar <= 0)
+		{
+			return false;
+		}
+
+		// NaN and Inf are the only values with an all-ones exponent, so one branch-free pass covers the common clean block
+		constexpr uint32 ExponentMask = 0x7F800000u;
+		uint32 MaxExponent = 0;
 		for (int32 Index = 0; Index < InNumSamples; ++Index)
 		{
-			// protect against divide by zero
-			OutBuffer[Index] = InputAudioDivide[Index] == 0.0f ? 0.0f : InBuffer[Index] / InputAudioDivide[Index];
+			uint32 Bits;
+			FMemory::Memcpy(&Bits, &InOutBuffer[Index], sizeof(float));
+			MaxExponent = FMath::Max(MaxExponent, Bits & ExponentMask);
+		}
+
+		if (MaxExponent != ExponentMask)
+		{
+			return false;
+		}
+
+		int32 NumNonFinite = 0;
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			if (!FMath::IsFinite(InOutBuffer[Index]))
+			{
+				InOutBuffer[Index] = 0.0f;
+				++NumNonFinite;
+			}
+		}
+
+		if (SanitizeNonFiniteCVar >= 2)
+		{
+			// a node stuck on Inf (e.g. Pow of silence with a negative exponent) would otherwise log every block
+			constexpr double LogIntervalSeconds = 1.0;
+			static std::atomic<double> LastLogTime { -LogIntervalSeconds };
+
+			const double Now = FPlatformTime::Seconds();
+			double LastLogged = LastLogTime.load(std::memory_order_relaxed);
+			if (Now - LastLogged >= LogIntervalSeconds && LastLogTime.compare_exchange_strong(LastLogged, Now, std::memory_order_relaxed))
+			{
+				UE_LOG(LogMetasoundsAudioMathUtils, Warning, TEXT("%s produced %d non-finite samples, resetting state."), InNodeName, NumNonFinite);
+			}
+		}
+
+		// the state that produced them is likely non-finite too, so always have the caller reset it
+		return true;
+	}
+#endif
+
+	void FAudioDivide::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputAudioDivide, const int32 InNumSamples)
+	{
+		if (IsBufferSilent(InBuffer, InNumSamples))
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
+		}
+
+		if (IsBufferUniform(InputAudioDivide, InNumSamples))
+		{
+			ProcessAudioBuffer(InBuffer, OutBuffer, InputAudioDivide[0], InNumSamples);
+			return;
+		}
+
+		TBinaryKernel<FDivideOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InputAudioDivide, InNumSamples);
+	}
+
+	void FAudioDivide::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InputAudioDivide, const int32 InNumSamples)
+	{
+		// protect against divide by zero
+		if (InputAudioDivide == 0.0f)
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
+		}
+
+		TBinaryKernel<FDivideOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InputAudioDivide, InNumSamples);
+	}
+
+	FClick::FClick()
+	{
+		// SetShape runs every block, so it must only ever rewrite memory that already exists
+		mShapeTable.Reserve(2 * MaxWidth);
+		mCarry.Reserve(2 * MaxWidth);
+
+		mShapeTable.Add(1.0f);
+	}
+
+	void FClick::SetShape(const EClickShape InShape, const int32 InWidth)
+	{
+		const int32 Width = FMath::Clamp(InWidth, 1, MaxWidth);
+		if (InShape == mShape && Width == mWidth && mShapeTable.Num() > 0)
+		{
+			return;
+		}
+
+		mShape = InShape;
+		mWidth = Width;
+		mShapeTable.Reset();
+
+		switch (InShape)
+		{
+		case EClickShape::Impulse:
+			mShapeTable.Add(1.0f);
+			break;
+
+		case EClickShape::Doublet:
+			// not Init, which resizes the allocation to fit
+			mShapeTable.SetNumUninitialized(2 * Width);
+			for (int32 Index = 0; Index < 2 * Width; ++Index)
+			{
+				mShapeTable[Index] = Index < Width ? 1.0f : -1.0f;
+			}
+			break;
+
+		case EClickShape::Triangle:
+			mShapeTable.SetNumUninitialized(2 * Width - 1);
+			for (int32 Index = 0; Index < mShapeTable.Num(); ++Index)
+			{
+				mShapeTable[Index] = 1.0f - FMath::Abs(Index - (Width - 1)) / (float)Width;
+			}
+			break;
+		}
+
+		// a tail from the previous shape may still be pending, so only ever grow the carry
+		if (mCarry.Num() < mShapeTable.Num())
+		{
+			mCarry.SetNumZeroed(mShapeTable.Num());
+		}
+	}
+
+	void FClick::BeginBlock(float* OutBuffer, const int32 InNumSamples)
+	{
+		const int32 DirtyEnd = FMath::Min(mDirtyEnd, InNumSamples);
+		if (DirtyEnd > mDirtyStart)
+		{
+			FMemory::Memzero(&OutBuffer[mDirtyStart], (DirtyEnd - mDirtyStart) * sizeof(float));
+		}
+
+		mDirtyStart = InNumSamples;
+		mDirtyEnd = 0;
+
+		if (mNumCarry > 0)
+		{
+			const int32 NumToWrite = FMath::Min(mNumCarry, InNumSamples);
+			FMemory::Memcpy(OutBuffer, mCarry.GetData(), NumToWrite * sizeof(float));
+			mDirtyStart = 0;
+			mDirtyEnd = NumToWrite;
+
+			// only shapes longer than a block leave anything behind
+			const int32 NumRemaining = mNumCarry - NumToWrite;
+			FMemory::Memmove(mCarry.GetData(), &mCarry[NumToWrite], NumRemaining * sizeof(float));
+			FMemory::Memzero(&mCarry[NumRemaining], NumToWrite * sizeof(float));
+			mNumCarry = NumRemaining;
+		}
+	}
+
+	void FClick::AddClick(float* OutBuffer, const int32 InFrame, const int32 InNumSamples)
+	{
+		const int32 ShapeLength = mShapeTable.Num();
+		const int32 NumInBlock = FMath::Min(ShapeLength, InNumSamples - InFrame);
+
+		for (int32 Index = 0; Index < NumInBlock; ++Index)
+		{
+			OutBuffer[InFrame + Index] += mShapeTable[Index];
+		}
+
+		mDirtyStart = FMath::Min(mDirtyStart, InFrame);
+		mDirtyEnd = FMath::Max(mDirtyEnd, InFrame + NumInBlock);
+
+		for (int32 Index = NumInBlock; Index < ShapeLength; ++Index)
+		{
+			mCarry[Index - NumInBlock] += mShapeTable[Index];
+		}
+
+		mNumCarry = FMath::Max(mNumCarry, ShapeLength - NumInBlock);
+	}
+
+	void FClick::Reset()
+	{
+		FMemory::Memzero(mCarry.GetData(), mCarry.Num() * sizeof(float));
+		mNumCarry = 0;
+		mDirtyStart = 0;
+		mDirtyEnd = 0;
+	}
+
+	static FORCEINLINE double WrapPhase(const double InPhase)
+	{
+		return InPhase - FMath::FloorToDouble(InPhase);
+	}
+
+	// Sine and Cos inputs within this many cycles of a straight line (wraps allowed) take the rotation path, so 2 PI
+	// times this bounds how far its output can move from the exact one.
+	static constexpr float LinearRampTolerance = 4.0e-6f;
+	static constexpr int32 MinLinearRampSamples = 16;
+
+	// how often the rotation path recomputes its lanes exactly, which also renormalizes them
+	static constexpr int32 RotationReseedInterval = 64;
+
+	// Fits InBuffer[Index] = OutStart + Index * OutIncrement (mod 1) from the endpoints, then checks every sample
+	// against the fit four at a time, bailing on the first miss so other signals only pay for a group or two.
+	static bool FindLinearRamp(const float* InBuffer, const int32 InNumSamples, double& OutStart, double& OutIncrement)
+	{
+		if (InNumSamples < MinLinearRampSamples)
+		{
+			return false;
+		}
+
+		// the first step only has to be close enough to count the wraps, the increment comes from the whole block
+		const int32 LastIndex = InNumSamples - 1;
+		const double Start = InBuffer[0];
+		const double End = InBuffer[LastIndex];
+		const double FirstStep = (double)InBuffer[1] - Start;
+		const double Wraps = FMath::RoundToDouble(Start + (FirstStep - FMath::RoundToDouble(FirstStep)) * LastIndex - End);
+		const double Increment = (End + Wraps - Start) / LastIndex;
+
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		const VectorRegister4Float Ramp = MakeVectorRegisterFloat(0.0f, (float)Increment, (float)(2.0 * Increment), (float)(3.0 * Increment));
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+		const VectorRegister4Float Tolerance = VectorSetFloat1(LinearRampTolerance);
+		double Expected = WrapPhase(Start);
+
+		int32 Index = 0;
+		for (; Index < NumVectorSamples; Index += 4)
+		{
+			// distance to the fit, ignoring whole cycles
+			VectorRegister4Float Residual = VectorSubtract(VectorLoad(&InBuffer[Index]), VectorAdd(VectorSetFloat1((float)Expected), Ramp));
+			Residual = VectorSubtract(Residual, VectorFloor(VectorAdd(Residual, Half)));
+
+			if (VectorMaskBits(VectorCompareGT(VectorAbs(Residual), Tolerance)))
+			{
+				return false;
+			}
+
+			Expected = WrapPhase(Expected + 4.0 * Increment);
+		}
+
+		for (; Index < InNumSamples; ++Index)
+		{
+			const double Residual = InBuffer[Index] - Expected;
+			if (FMath::Abs(Residual - FMath::RoundToDouble(Residual)) > LinearRampTolerance)
+			{
+				return false;
+			}
+
+			Expected = WrapPhase(Expected + Increment);
+		}
+
+		OutStart = Start;
+		OutIncrement = Increment;
+		return true;
+	}
+
+	// Sin or cos of 2 PI (InStart + Index * InIncrement). Four lanes a sample apart are rotated by four samples of
+	// phase per group, a complex multiply instead of a transcendental per sample.
+	template<bool bIsCosine>
+	static void ProcessLinearRamp(const double InStart, const double InIncrement, float* OutBuffer, const int32 InNumSamples)
+	{
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		const double GroupIncrement = 4.0 * InIncrement;
+
+		const VectorRegister4Float Ramp = MakeVectorRegisterFloat(0.0f, (float)InIncrement, (float)(2.0 * InIncrement), (float)(3.0 * InIncrement));
+		const VectorRegister4Float TwoPi = VectorSetFloat1(2.0f * PI);
+		const VectorRegister4Float RotationCos = VectorSetFloat1((float)FMath::Cos(2.0 * UE_DOUBLE_PI * GroupIncrement));
+		const VectorRegister4Float RotationSin = VectorSetFloat1((float)FMath::Sin(2.0 * UE_DOUBLE_PI * GroupIncrement));
+
+		VectorRegister4Float Cos = VectorZeroFloat();
+		VectorRegister4Float Sin = VectorZeroFloat();
+		double Phase = WrapPhase(InStart);
+
+		for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+		{
+			if (Index % RotationReseedInterval == 0)
+			{
+				VectorRegister4Float Phases = VectorAdd(VectorSetFloat1((float)Phase), Ramp);
+				Phases = VectorMultiply(TwoPi, VectorSubtract(Phases, VectorFloor(Phases)));
+				VectorSinCos(&Sin, &Cos, &Phases);
+			}
+			else
+			{
+				const VectorRegister4Float RotatedCos = VectorSubtract(VectorMultiply(Cos, RotationCos), VectorMultiply(Sin, RotationSin));
+				Sin = VectorMultiplyAdd(Cos, RotationSin, VectorMultiply(Sin, RotationCos));
+				Cos = RotatedCos;
+			}
+
+			VectorStore(bIsCosine ? Cos : Sin, &OutBuffer[Index]);
+			Phase = WrapPhase(Phase + GroupIncrement);
+		}
+
+		for (int32 Index = NumVectorSamples; Index < InNumSamples; ++Index)
+		{
+			OutBuffer[Index] = bIsCosine ? FCosOp::Scalar((float)Phase) : FSineOp::Scalar((float)Phase);
+			Phase = WrapPhase(Phase + InIncrement);
 		}
 	}
 
 	void FCos::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		double Start = 0.0;
+		double Increment = 0.0;
+		if (FindLinearRamp(InBuffer, InNumSamples, Start, Increment))
 		{
-			OutBuffer[Index] = FMath::Cos((2.0f * PI) * InBuffer[Index]);
+			ProcessLinearRamp<true>(Start, Increment, OutBuffer, InNumSamples);
+			return;
 		}
+
+		TUnaryKernel<FCosOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
 	}
 
 	void FGate::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputGateToggle, const int32 InNumSamples)
+	{
+		if (IsBufferSilent(InBuffer, InNumSamples))
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
+		}
+
+		if (IsBufferUniform(InputGateToggle, InNumSamples))
+		{
+			ProcessAudioBuffer(InBuffer, OutBuffer, InputGateToggle[0], InNumSamples);
+			return;
+		}
+
+		TBinaryKernel<FGateOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InputGateToggle, InNumSamples);
+	}
+
+	void FGate::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InputGateToggle, const int32 InNumSamples)
+	{
+		if (FMath::RoundHalfFromZero(InputGateToggle) == 0.0f)
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+		}
+		else if (OutBuffer != InBuffer)
+		{
+			FMemory::Memcpy(OutBuffer, InBuffer, InNumSamples * sizeof(float));
+		}
+	}
+
+	// 0^p is only 0 for p > 0, so the silent shortcut needs every exponent in the block to be positive
+	static bool IsExponentPositive(const float* InputPowerOf, const int32 InNumSamples)
 	{
 		for (int32 Index = 0; Index < InNumSamples; ++Index)
 		{
-			OutBuffer[Index] = FMath::RoundHalfFromZero(InputGateToggle[Index]) != 0.0f ? InBuffer[Index] : 0.0f;
+			if (!(InputPowerOf[Index] > 0.0f))
+			{
+				return false;
+			}
 		}
+
+		return true;
 	}
 
 	void FPow::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples)
 	{
-		float inVal, powVal = 0.0f;
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		if (IsBufferSilent(InBuffer, InNumSamples) && IsExponentPositive(InputPowerOf, InNumSamples))
+		{
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
+		}
+
+		if (IsBufferUniform(InputPowerOf, InNumSamples))
+		{
+			ProcessAudioBuffer(InBuffer, OutBuffer, InputPowerOf[0], InNumSamples);
+			return;
+		}
+
+		TBinaryKernel<FPowOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InputPowerOf, InNumSamples);
+	}
+
+	void FPow::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InputPowerOf, const int32 InNumSamples)
+	{
+		// common exponents skip the transcendental entirely
+		if (InputPowerOf == 1.0f)
 		{
-			inVal = InBuffer[Index];
-			powVal = InputPowerOf[Index];
-			if (inVal < 0.0f)
+			if (OutBuffer != InBuffer)
 			{
-				OutBuffer[Index] = -1 * FMath::Pow(FMath::Abs(inVal), powVal);
+				FMemory::Memcpy(OutBuffer, InBuffer, InNumSamples * sizeof(float));
 			}
-			else
+			return;
+		}
+
+		if (InputPowerOf == 2.0f)
+		{
+			for (int32 Index = 0; Index < InNumSamples; ++Index)
 			{
-				OutBuffer[Index] = FMath::Pow(FMath::Abs(inVal), powVal);
+				OutBuffer[Index] = InBuffer[Index] * FMath::Abs(InBuffer[Index]);
 			}
+			return;
 		}
+
+		TBinaryKernel<FPowOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InputPowerOf, InNumSamples);
+	}
+
+	void FPow::ProcessAntiderivative(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples)
+	{
+		TBinaryAntiderivativeKernel<FPowOp>::Process(InBuffer, OutBuffer, InputPowerOf, InNumSamples, mAntiderivativeState);
 	}
 
 	void FOnePoleIIR::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		if (IsBufferUniform(coefA, InNumSamples) && IsBufferUniform(coefB, InNumSamples))
+		{
+			ProcessAudioBuffer(InBuffer, OutBuffer, coefA[0], coefB[0], InNumSamples);
+			return;
+		}
+
+		if (mProcessModulatedBlock && InNumSamples == mBlockSize)
+		{
+			(this->*mProcessModulatedBlock)(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+		else
+		{
+			ProcessModulatedBlock<0>(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+
+		mPreviousSample = FlushDenormalToZero(mPreviousSample);
+	}
+
+	void FOnePoleIIR::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples)
+	{
+		if (mProcessFixedBlock && InNumSamples == mBlockSize)
 		{
-			OutBuffer[Index] = InBuffer[Index] * coefB[Index] + mPreviousSample * coefA[Index];
-			mPreviousSample = OutBuffer[Index];
+			(this->*mProcessFixedBlock)(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+		else
+		{
+			ProcessFixedBlock<0>(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+
+		mPreviousSample = FlushDenormalToZero(mPreviousSample);
+	}
+
+	template<int32 BlockSize>
+	void FOnePoleIIR::ProcessModulatedBlock(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples)
+	{
+		const int32 NumSamples = BlockSize > 0 ? BlockSize : InNumSamples;
+
+		float previousSample = mPreviousSample;
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			previousSample = InBuffer[Index] * coefB[Index] + previousSample * coefA[Index];
+			OutBuffer[Index] = previousSample;
+		}
+
+		mPreviousSample = previousSample;
+	}
+
+	template<int32 BlockSize>
+	void FOnePoleIIR::ProcessFixedBlock(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples)
+	{
+		const int32 NumSamples = BlockSize > 0 ? BlockSize : InNumSamples;
+
+		float previousSample = mPreviousSample;
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			previousSample = InBuffer[Index] * coefB + previousSample * coefA;
+			OutBuffer[Index] = previousSample;
+		}
+
+		mPreviousSample = previousSample;
+	}
+
+	void FOnePoleIIR::SetBlockSize(const int32 InNumFramesPerBlock)
+	{
+		mBlockSize = InNumFramesPerBlock;
+
+		switch (InNumFramesPerBlock)
+		{
+		case ConsoleBlockSize:
+			mProcessModulatedBlock = &FOnePoleIIR::ProcessModulatedBlock<ConsoleBlockSize>;
+			mProcessFixedBlock = &FOnePoleIIR::ProcessFixedBlock<ConsoleBlockSize>;
+			break;
+
+		case DesktopBlockSize:
+			mProcessModulatedBlock = &FOnePoleIIR::ProcessModulatedBlock<DesktopBlockSize>;
+			mProcessFixedBlock = &FOnePoleIIR::ProcessFixedBlock<DesktopBlockSize>;
+			break;
+
+		default:
+			mProcessModulatedBlock = &FOnePoleIIR::ProcessModulatedBlock<0>;
+			mProcessFixedBlock = &FOnePoleIIR::ProcessFixedBlock<0>;
+			break;
+		}
+	}
+
+	void FOnePoleIIR::Reset()
+	{
+		mPreviousSample = 0.0f;
+	}
+
+	FOnePoleIIRBank::FOnePoleIIRBank()
+	{
+		SetCoefficients(0.0f, 1.0f);
+		Reset();
+	}
+
+	void FOnePoleIIRBank::SetCoefficients(const float InCoefA, const float InCoefB)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			SetCoefficients(Lane, InCoefA, InCoefB);
+		}
+	}
+
+	void FOnePoleIIRBank::SetCoefficients(const int32 InLane, const float InCoefA, const float InCoefB)
+	{
+		mCoefA[InLane] = InCoefA;
+		mCoefB[InLane] = InCoefB;
+	}
+
+	void FOnePoleIIRBank::Reset()
+	{
+		FMemory::Memzero(mState, sizeof(mState));
+	}
+
+	void FOnePoleIIRBank::ProcessAudioBuffers(const float* const* InBuffers, float* const* OutBuffers, const int32 InNumSamples)
+	{
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			ProcessGroup(Group, InBuffers, OutBuffers, InNumSamples);
+		}
+	}
+
+	void FOnePoleIIRBank::ProcessGroup(const int32 InGroup, const float* const* InBuffers, float* const* OutBuffers, const int32 InNumSamples)
+	{
+		const int32 FirstLane = InGroup * LanesPerGroup;
+		const float* const* In = &InBuffers[FirstLane];
+		float* const* Out = &OutBuffers[FirstLane];
+
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		VectorRegister4Float State = VectorLoadAligned(&mState[FirstLane]);
+
+		// unused lanes of a bank are usually silent, skip the recurrence once they have decayed
+		if (VectorMaskBits(VectorCompareNE(State, Zero)) == 0
+			&& IsBufferSilent(In[0], InNumSamples) && IsBufferSilent(In[1], InNumSamples)
+			&& IsBufferSilent(In[2], InNumSamples) && IsBufferSilent(In[3], InNumSamples))
+		{
+			for (int32 Lane = 0; Lane < LanesPerGroup; ++Lane)
+			{
+				FMemory::Memzero(Out[Lane], InNumSamples * sizeof(float));
+			}
+			return;
+		}
+
+		const VectorRegister4Float CoefA = VectorLoadAligned(&mCoefA[FirstLane]);
+		const VectorRegister4Float CoefB = VectorLoadAligned(&mCoefB[FirstLane]);
+
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+		{
+			// rows are four samples of one lane, columns four lanes of one sample
+			const VectorRegister4Float Row0 = VectorLoadAligned(&In[0][Index]);
+			const VectorRegister4Float Row1 = VectorLoadAligned(&In[1][Index]);
+			const VectorRegister4Float Row2 = VectorLoadAligned(&In[2][Index]);
+			const VectorRegister4Float Row3 = VectorLoadAligned(&In[3][Index]);
+
+			const VectorRegister4Float Low01 = VectorShuffle(Row0, Row1, 0, 1, 0, 1);
+			const VectorRegister4Float High01 = VectorShuffle(Row0, Row1, 2, 3, 2, 3);
+			const VectorRegister4Float Low23 = VectorShuffle(Row2, Row3, 0, 1, 0, 1);
+			const VectorRegister4Float High23 = VectorShuffle(Row2, Row3, 2, 3, 2, 3);
+
+			const VectorRegister4Float Column0 = VectorShuffle(Low01, Low23, 0, 2, 0, 2);
+			const VectorRegister4Float Column1 = VectorShuffle(Low01, Low23, 1, 3, 1, 3);
+			const VectorRegister4Float Column2 = VectorShuffle(High01, High23, 0, 2, 0, 2);
+			const VectorRegister4Float Column3 = VectorShuffle(High01, High23, 1, 3, 1, 3);
+
+			// separate multiply and add rather than VectorMultiplyAdd, which is fused on NEON and AVX2 builds. Each lane
+			// matches FOnePoleIIR within rounding, and bit for bit unless the compiler contracts FOnePoleIIR's scalar
+			// a * b + c * d into an FMA, which it may do under floating point contraction.
+			const VectorRegister4Float Output0 = VectorAdd(VectorMultiply(CoefB, Column0), VectorMultiply(CoefA, State));
+			const VectorRegister4Float Output1 = VectorAdd(VectorMultiply(CoefB, Column1), VectorMultiply(CoefA, Output0));
+			const VectorRegister4Float Output2 = VectorAdd(VectorMultiply(CoefB, Column2), VectorMultiply(CoefA, Output1));
+			const VectorRegister4Float Output3 = VectorAdd(VectorMultiply(CoefB, Column3), VectorMultiply(CoefA, Output2));
+			State = Output3;
+
+			// the same transpose takes columns back to rows
+			const VectorRegister4Float OutLow01 = VectorShuffle(Output0, Output1, 0, 1, 0, 1);
+			const VectorRegister4Float OutHigh01 = VectorShuffle(Output0, Output1, 2, 3, 2, 3);
+			const VectorRegister4Float OutLow23 = VectorShuffle(Output2, Output3, 0, 1, 0, 1);
+			const VectorRegister4Float OutHigh23 = VectorShuffle(Output2, Output3, 2, 3, 2, 3);
+
+			VectorStoreAligned(VectorShuffle(OutLow01, OutLow23, 0, 2, 0, 2), &Out[0][Index]);
+			VectorStoreAligned(VectorShuffle(OutLow01, OutLow23, 1, 3, 1, 3), &Out[1][Index]);
+			VectorStoreAligned(VectorShuffle(OutHigh01, OutHigh23, 0, 2, 0, 2), &Out[2][Index]);
+			VectorStoreAligned(VectorShuffle(OutHigh01, OutHigh23, 1, 3, 1, 3), &Out[3][Index]);
+		}
+
+		VectorStoreAligned(State, &mState[FirstLane]);
+
+		for (int32 Lane = 0; Lane < LanesPerGroup; ++Lane)
+		{
+			const int32 BankLane = FirstLane + Lane;
+			float PreviousSample = mState[BankLane];
+			for (int32 Index = NumVectorSamples; Index < InNumSamples; ++Index)
+			{
+				PreviousSample = In[Lane][Index] * mCoefB[BankLane] + PreviousSample * mCoefA[BankLane];
+				Out[Lane][Index] = PreviousSample;
+			}
+
+			mState[BankLane] = FlushDenormalToZero(PreviousSample);
 		}
 	}
 
 	void FOnePoleFIR::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		if (IsBufferUniform(coefA, InNumSamples) && IsBufferUniform(coefB, InNumSamples))
+		{
+			ProcessAudioBuffer(InBuffer, OutBuffer, coefA[0], coefB[0], InNumSamples);
+			return;
+		}
+
+		if (mProcessModulatedBlock && InNumSamples == mBlockSize)
+		{
+			(this->*mProcessModulatedBlock)(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+		else
 		{
-			OutBuffer[Index] = InBuffer[Index] * coefB[Index] + mPreviousInputSample * coefA[Index];
-			mPreviousInputSample = InBuffer[Index];
+			ProcessModulatedBlock<0>(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
 		}
 	}
 
-	void FSamphold::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputSampholdPhasor, const int32 InNumSamples)
+	void FOnePoleFIR::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		if (mProcessFixedBlock && InNumSamples == mBlockSize)
+		{
+			(this->*mProcessFixedBlock)(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+		else
+		{
+			ProcessFixedBlock<0>(InBuffer, OutBuffer, coefA, coefB, InNumSamples);
+		}
+	}
+
+	template<int32 BlockSize>
+	void FOnePoleFIR::ProcessModulatedBlock(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples)
+	{
+		const int32 NumSamples = BlockSize > 0 ? BlockSize : InNumSamples;
+
+		float previousInputSample = mPreviousInputSample;
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			const float inputSample = InBuffer[Index];
+			OutBuffer[Index] = inputSample * coefB[Index] + previousInputSample * coefA[Index];
+			previousInputSample = inputSample;
+		}
+
+		mPreviousInputSample = previousInputSample;
+	}
+
+	template<int32 BlockSize>
+	void FOnePoleFIR::ProcessFixedBlock(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples)
+	{
+		const int32 NumSamples = BlockSize > 0 ? BlockSize : InNumSamples;
+
+		float previousInputSample = mPreviousInputSample;
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			const float inputSample = InBuffer[Index];
+			OutBuffer[Index] = inputSample * coefB + previousInputSample * coefA;
+			previousInputSample = inputSample;
+		}
+
+		mPreviousInputSample = previousInputSample;
+	}
+
+	void FOnePoleFIR::SetBlockSize(const int32 InNumFramesPerBlock)
+	{
+		mBlockSize = InNumFramesPerBlock;
+
+		switch (InNumFramesPerBlock)
+		{
+		case ConsoleBlockSize:
+			mProcessModulatedBlock = &FOnePoleFIR::ProcessModulatedBlock<ConsoleBlockSize>;
+			mProcessFixedBlock = &FOnePoleFIR::ProcessFixedBlock<ConsoleBlockSize>;
+			break;
+
+		case DesktopBlockSize:
+			mProcessModulatedBlock = &FOnePoleFIR::ProcessModulatedBlock<DesktopBlockSize>;
+			mProcessFixedBlock = &FOnePoleFIR::ProcessFixedBlock<DesktopBlockSize>;
+			break;
+
+		default:
+			mProcessModulatedBlock = &FOnePoleFIR::ProcessModulatedBlock<0>;
+			mProcessFixedBlock = &FOnePoleFIR::ProcessFixedBlock<0>;
+			break;
+		}
+	}
+
+	void FOnePoleFIR::Reset()
+	{
+		mPreviousInputSample = 0.0f;
+	}
+
+	// first index in [InStartFrame, InNumSamples) where InBuffer[Index] > InThreshold (or < for bInBelow)
+	template<bool bInBelow>
+	static int32 FindFirstCrossing(const float* InBuffer, const float InThreshold, const int32 InStartFrame, const int32 InNumSamples)
+	{
+		const VectorRegister4Float Threshold = VectorSetFloat1(InThreshold);
+		const int32 NumVectorSamples = InStartFrame + ((InNumSamples - InStartFrame) & ~3);
+
+		int32 Index = InStartFrame;
+		for (; Index < NumVectorSamples; Index += 4)
+		{
+			const VectorRegister4Float Samples = VectorLoad(&InBuffer[Index]);
+			const uint32 Mask = VectorMaskBits(bInBelow ? VectorCompareLT(Samples, Threshold) : VectorCompareGT(Samples, Threshold));
+			if (Mask)
+			{
+				return Index + FMath::CountTrailingZeros(Mask);
+			}
+		}
+
+		for (; Index < InNumSamples; ++Index)
+		{
+			if (bInBelow ? InBuffer[Index] < InThreshold : InBuffer[Index] > InThreshold)
+			{
+				return Index;
+			}
+		}
+
+		return InNumSamples;
+	}
+
+	void FSchmittTrigger::SetThreshold(const float InThreshold, const float InHysteresis)
+	{
+		const float HalfHysteresis = 0.5f * FMath::Max(InHysteresis, 0.0f);
+		mUpperThreshold = InThreshold + HalfHysteresis;
+		mLowerThreshold = InThreshold - HalfHysteresis;
+	}
+
+	int32 FSchmittTrigger::FindNextEdge(const float* InBuffer, const int32 InStartFrame, const int32 InNumSamples, bool& bOutIsRising)
+	{
+		const int32 EdgeFrame = bIsHigh
+			? FindFirstCrossing<true>(InBuffer, mLowerThreshold, InStartFrame, InNumSamples)
+			: FindFirstCrossing<false>(InBuffer, mUpperThreshold, InStartFrame, InNumSamples);
+
+		if (EdgeFrame < InNumSamples)
 		{
-			if (InputSampholdPhasor[Index] < mPreviousPhasorValue)
+			bIsHigh = !bIsHigh;
+		}
+
+		bOutIsRising = bIsHigh;
+		return EdgeFrame;
+	}
+
+	void FSchmittTrigger::Reset()
+	{
+		bIsHigh = false;
+	}
+
+	static void FillBuffer(float* OutBuffer, const float InValue, const int32 InNumSamples)
+	{
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		const VectorRegister4Float Value = VectorSetFloat1(InValue);
+
+		for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+		{
+			VectorStore(Value, &OutBuffer[Index]);
+		}
+
+		for (int32 Index = NumVectorSamples; Index < InNumSamples; ++Index)
+		{
+			OutBuffer[Index] = InValue;
+		}
+	}
+
+	// first index in [InStartFrame, InNumSamples) where InPhasor[Index] < InPhasor[Index - 1], InStartFrame >= 1
+	static int32 FindPhasorWrap(const float* InPhasor, const int32 InStartFrame, const int32 InNumSamples)
+	{
+		const int32 NumVectorSamples = InStartFrame + ((InNumSamples - InStartFrame) & ~3);
+
+		// compares each group of four with the same four shifted back a sample
+		int32 Index = InStartFrame;
+		for (; Index < NumVectorSamples; Index += 4)
+		{
+			const uint32 Mask = VectorMaskBits(VectorCompareLT(VectorLoad(&InPhasor[Index]), VectorLoad(&InPhasor[Index - 1])));
+			if (Mask)
 			{
-				mHeldSample = InBuffer[Index];
+				return Index + FMath::CountTrailingZeros(Mask);
 			}
+		}
 
-			OutBuffer[Index] = mHeldSample;
-			mPreviousPhasorValue = InputSampholdPhasor[Index];
+		for (; Index < InNumSamples; ++Index)
+		{
+			if (InPhasor[Index] < InPhasor[Index - 1])
+			{
+				return Index;
+			}
 		}
+
+		return InNumSamples;
+	}
+
+	void FSamphold::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputSampholdPhasor, const int32 InNumSamples)
+	{
+		if (InNumSamples <= 0)
+		{
+			return;
+		}
+
+		// the first sample compares against the end of the previous block
+		int32 WrapFrame = InputSampholdPhasor[0] < mPreviousPhasorValue ? 0 : FindPhasorWrap(InputSampholdPhasor, 1, InNumSamples);
+		int32 SpanStart = 0;
+
+		while (WrapFrame < InNumSamples)
+		{
+			FillBuffer(&OutBuffer[SpanStart], mHeldSample, WrapFrame - SpanStart);
+
+			mHeldSample = InBuffer[WrapFrame];
+			SpanStart = WrapFrame;
+			WrapFrame = FindPhasorWrap(InputSampholdPhasor, WrapFrame + 1, InNumSamples);
+		}
+
+		FillBuffer(&OutBuffer[SpanStart], mHeldSample, InNumSamples - SpanStart);
+		mPreviousPhasorValue = InputSampholdPhasor[InNumSamples - 1];
+	}
+
+	void FSamphold::Hold(float* OutBuffer, const int32 InStartFrame, const int32 InEndFrame) const
+	{
+		FillBuffer(&OutBuffer[InStartFrame], mHeldSample, InEndFrame - InStartFrame);
+	}
+
+	void FSamphold::SampleAndHold(const float* InBuffer, float* OutBuffer, const int32 InTriggerFrame, const int32 InEndFrame)
+	{
+		mHeldSample = InBuffer[InTriggerFrame];
+		Hold(OutBuffer, InTriggerFrame, InEndFrame);
+	}
+
+	void FSamphold::Reset()
+	{
+		mHeldSample = 0.0f;
+		mPreviousPhasorValue = 0.0f;
 	}
 
 	void FSine::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		double Start = 0.0;
+		double Increment = 0.0;
+		if (FindLinearRamp(InBuffer, InNumSamples, Start, Increment))
 		{
-			OutBuffer[Index] = FMath::Sin((2.0f * PI) * InBuffer[Index]);
+			ProcessLinearRamp<false>(Start, Increment, OutBuffer, InNumSamples);
+			return;
 		}
+
+		TUnaryKernel<FSineOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+	}
+
+	void FSineOscillator::Init(const float InSampleRate)
+	{
+		mInverseSampleRate = 1.0 / (double)InSampleRate;
+	}
+
+	void FSineOscillator::ProcessAudioBuffer(const float* InFrequency, const float* InPhaseMod, float* OutBuffer, const int32 InNumSamples)
+	{
+		const int32 NumVectorSamples = InNumSamples & ~3;
+		double Phase = mPhase;
+
+		// Each group of four adds its in-group ramp to the double phase in float, so the rounding never accumulates.
+		if (IsBufferUniform(InFrequency, InNumSamples))
+		{
+			const double Increment = (double)InFrequency[0] * mInverseSampleRate;
+			const VectorRegister4Float Ramp = MakeVectorRegisterFloat(0.0f, (float)Increment, (float)(2.0 * Increment), (float)(3.0 * Increment));
+
+			for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+			{
+				const VectorRegister4Float Phases = VectorAdd(VectorAdd(VectorSetFloat1((float)Phase), Ramp), VectorLoad(&InPhaseMod[Index]));
+				VectorStore(FSineOp::Vector(VectorSubtract(Phases, VectorFloor(Phases))), &OutBuffer[Index]);
+
+				Phase = WrapPhase(Phase + 4.0 * Increment);
+			}
+		}
+		else
+		{
+			const VectorRegister4Float Zero = VectorZeroFloat();
+			const VectorRegister4Float InverseSampleRate = VectorSetFloat1((float)mInverseSampleRate);
+
+			for (int32 Index = 0; Index < NumVectorSamples; Index += 4)
+			{
+				const VectorRegister4Float Increments = VectorMultiply(VectorLoad(&InFrequency[Index]), InverseSampleRate);
+
+				// inclusive prefix sum across the lanes: add the increments shifted by one lane, then by two
+				VectorRegister4Float Sums = VectorAdd(Increments, VectorShuffle(VectorShuffle(Zero, Increments, 0, 0, 0, 0), Increments, 1, 2, 1, 2));
+				Sums = VectorAdd(Sums, VectorShuffle(Zero, Sums, 0, 0, 0, 1));
+
+				const VectorRegister4Float Ramp = VectorSubtract(Sums, Increments);
+				const VectorRegister4Float Phases = VectorAdd(VectorAdd(VectorSetFloat1((float)Phase), Ramp), VectorLoad(&InPhaseMod[Index]));
+				VectorStore(FSineOp::Vector(VectorSubtract(Phases, VectorFloor(Phases))), &OutBuffer[Index]);
+
+				// the float sums would bias the phase a little every group, so advance it in double
+				Phase = WrapPhase(Phase + ((double)InFrequency[Index] + InFrequency[Index + 1] + InFrequency[Index + 2] + InFrequency[Index + 3]) * mInverseSampleRate);
+			}
+		}
+
+		for (int32 Index = NumVectorSamples; Index < InNumSamples; ++Index)
+		{
+			OutBuffer[Index] = FSineOp::Scalar((float)WrapPhase(Phase + InPhaseMod[Index]));
+			Phase = WrapPhase(Phase + (double)InFrequency[Index] * mInverseSampleRate);
+		}
+
+		mPhase = Phase;
+	}
+
+	void FSineOscillator::Reset()
+	{
+		mPhase = 0.0;
 	}
 
 	void FSqrt::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		if (IsBufferSilent(InBuffer, InNumSamples))
 		{
-			OutBuffer[Index] = (InBuffer[Index] < 0 ? -1 : 1) * FMath::Sqrt(FMath::Abs(InBuffer[Index]));
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
 		}
+
+		TUnaryKernel<FSqrtOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+	}
+
+	void FSqrt::ProcessAntiderivative(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		TUnaryAntiderivativeKernel<FSqrtOp>::Process(InBuffer, OutBuffer, InNumSamples, mAntiderivativeState);
 	}
 
 	float sWrap(float input)
@@ -117,10 +1177,18 @@ namespace DSPProcessing
 
 	void FWrap::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
 	{
-		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		if (IsBufferSilent(InBuffer, InNumSamples))
 		{
-			OutBuffer[Index] = sWrap(InBuffer[Index]);
+			FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+			return;
 		}
+
+		TUnaryKernel<FWrapOp>::ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+	}
+
+	void FWrap::ProcessAntiderivative(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		TUnaryAntiderivativeKernel<FWrapOp>::Process(InBuffer, OutBuffer, InNumSamples, mAntiderivativeState);
 	}
 
 } // namespace DSPProcessing
@@ -0,0 +1,113 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "CoefficientDesigner.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+namespace DSPProcessing
+{
+	namespace CoefficientDesignWorkerPrivate
+	{
+		// how long a request can wait to be picked up, well under a block at usual sizes
+		constexpr uint32 PollIntervalMs = 2;
+
+		class FWorker : public FRunnable
+		{
+		public:
+			FWorker()
+				: WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+			{
+				Thread = FRunnableThread::Create(this, TEXT("MetasoundsAudioMathUtils Coefficient Designer"), 0, TPri_BelowNormal);
+			}
+
+			virtual ~FWorker() override
+			{
+				bStopping.store(true);
+				WakeEvent->Trigger();
+
+				if (Thread != nullptr)
+				{
+					Thread->WaitForCompletion();
+					delete Thread;
+				}
+
+				FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+			}
+
+			void AddJob(const FCoefficientDesignJobRef& InJob)
+			{
+				{
+					FScopeLock Lock(&NewJobsCriticalSection);
+					NewJobs.Add(InJob);
+				}
+
+				WakeEvent->Trigger();
+			}
+
+			virtual uint32 Run() override
+			{
+				// only touched by this thread, so dropping a finished job frees its state here
+				TArray<FCoefficientDesignJobRef> Jobs;
+
+				while (!bStopping.load())
+				{
+					{
+						FScopeLock Lock(&NewJobsCriticalSection);
+						Jobs.Append(NewJobs);
+						NewJobs.Reset();
+					}
+
+					for (int32 Index = Jobs.Num() - 1; Index >= 0; --Index)
+					{
+						if (!Jobs[Index]->Run())
+						{
+							Jobs.RemoveAtSwap(Index);
+						}
+					}
+
+					// with no designers alive there is nothing to poll until one is added
+					WakeEvent->Wait(Jobs.Num() > 0 ? PollIntervalMs : MAX_uint32);
+				}
+
+				return 0;
+			}
+
+		private:
+			FEvent* WakeEvent = nullptr;
+			FRunnableThread* Thread = nullptr;
+			std::atomic<bool> bStopping { false };
+
+			FCriticalSection NewJobsCriticalSection;
+			TArray<FCoefficientDesignJobRef> NewJobs;
+		};
+
+		FCriticalSection WorkerCriticalSection;
+		TUniquePtr<FWorker> Worker;
+	}
+
+	void FCoefficientDesignWorker::AddJob(const FCoefficientDesignJobRef& InJob)
+	{
+		using namespace CoefficientDesignWorkerPrivate;
+
+		FScopeLock Lock(&WorkerCriticalSection);
+
+		if (!Worker.IsValid())
+		{
+			Worker = MakeUnique<FWorker>();
+		}
+
+		Worker->AddJob(InJob);
+	}
+
+	void FCoefficientDesignWorker::Shutdown()
+	{
+		using namespace CoefficientDesignWorkerPrivate;
+
+		FScopeLock Lock(&WorkerCriticalSection);
+		Worker.Reset();
+	}
+}
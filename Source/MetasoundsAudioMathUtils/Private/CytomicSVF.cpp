@@ -4,6 +4,7 @@
 // Code based on this algorithm: https://gist.github.com/hollance/2891d89c57adc71d9560bcf0e1e55c4b
 
 #include "CytomicSVF.h"
+#include "AudioUtils.h"
 #include "Math/UnrealMathUtility.h"
 #include "DSP/Dsp.h"
 
@@ -22,7 +23,6 @@ void CytomicSVF::SetLPF()
 	m2 = 1.0f;
 }
 
-// currently feeding back so not exposed to MS node
 void CytomicSVF::setHPF()
 {
 	m0 = 1.0f;
@@ -37,25 +37,142 @@ void CytomicSVF::setBP()
 	m2 = 0.0f;
 }
 
+FORCEINLINE void CytomicSVF::UpdateCoefficients(const float CutoffFreq, const float QAmount)
+{
+	g = Audio::FastTan(PI * CutoffFreq / fs);
+	k = 1.0f / FMath::Max(QAmount, minQ);
+	a1 = 1.0f / (1.0f + g * (g + k));
+	a2 = g * a1;
+	a3 = g * a2;
+}
+
+FORCEINLINE float CytomicSVF::ProcessSample(const float InSample)
+{
+	float v3 = InSample - ic2eq;
+	float v1 = a1 * ic1eq + a2 * v3;
+	float v2 = ic2eq + a2 * ic1eq + a3 * v3;
+	ic1eq = 2.0f * v1 - ic1eq;
+	ic2eq = 2.0f * v2 - ic2eq;
+
+	// mixes from the input, never the output buffer, so processing in place is safe
+	return m0 * InSample + m1 * k * v1 + m2 * v2;
+}
+
+void CytomicSVF::FinishBlock()
+{
+	// snap decayed state so an idle filter doesn't keep running on denormals
+	ic1eq = FlushDenormalToZero(ic1eq);
+	ic2eq = FlushDenormalToZero(ic2eq);
+
+	// a non-finite input or cutoff would otherwise poison the state for good
+	if (!FMath::IsFinite(ic1eq) || !FMath::IsFinite(ic2eq))
+	{
+		Reset();
+	}
+}
+
 void CytomicSVF::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples)
 {
-	for (int i = 0; i < InNumSamples; ++i)
+	// constant cutoff and Q only need the coefficients once per block
+	if (IsBufferUniform(CutoffFreq, InNumSamples) && IsBufferUniform(QAmount, InNumSamples))
+	{
+		ProcessAudioBuffer(InBuffer, OutBuffer, CutoffFreq[0], QAmount[0], InNumSamples);
+		return;
+	}
+
+	// once the state has decayed to zero a silent input can only produce silence
+	if (ic1eq == 0.0f && ic2eq == 0.0f && IsBufferSilent(InBuffer, InNumSamples))
+	{
+		FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+		return;
+	}
+
+	if (mProcessModulatedBlock && InNumSamples == mBlockSize)
+	{
+		(this->*mProcessModulatedBlock)(InBuffer, OutBuffer, CutoffFreq, QAmount, InNumSamples);
+	}
+	else
+	{
+		ProcessModulatedBlock<0>(InBuffer, OutBuffer, CutoffFreq, QAmount, InNumSamples);
+	}
+
+	FinishBlock();
+}
+
+void CytomicSVF::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float CutoffFreq, const float QAmount, const int32 InNumSamples)
+{
+	if (ic1eq == 0.0f && ic2eq == 0.0f && IsBufferSilent(InBuffer, InNumSamples))
+	{
+		FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+		return;
+	}
+
+	UpdateCoefficients(CutoffFreq, QAmount);
+
+	if (mProcessFixedBlock && InNumSamples == mBlockSize)
+	{
+		(this->*mProcessFixedBlock)(InBuffer, OutBuffer, InNumSamples);
+	}
+	else
+	{
+		ProcessFixedBlock<0>(InBuffer, OutBuffer, InNumSamples);
+	}
+
+	FinishBlock();
+}
+
+template<int32 BlockSize>
+void CytomicSVF::ProcessModulatedBlock(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples)
+{
+	const int32 NumSamples = BlockSize > 0 ? BlockSize : InNumSamples;
+
+	for (int32 i = 0; i < NumSamples; ++i)
 	{
 		//calc coefficients
-		g = Audio::FastTan(PI * CutoffFreq[i] / fs);
-		k = 1.0f / QAmount[i];
-		a1 = 1.0f / (1.0f + g * (g + k));
-		a2 = g * a1;
-		a3 = g * a2;
+		UpdateCoefficients(CutoffFreq[i], QAmount[i]);
+
+		OutBuffer[i] = ProcessSample(InBuffer[i]);
+	}
+}
+
+template<int32 BlockSize>
+void CytomicSVF::ProcessFixedBlock(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+{
+	const int32 NumSamples = BlockSize > 0 ? BlockSize : InNumSamples;
+
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		OutBuffer[i] = ProcessSample(InBuffer[i]);
+	}
+}
 
-		float v3 = InBuffer[i] - ic2eq;
-		float v1 = a1 * ic1eq + a2 * v3;
-		float v2 = ic2eq + a2 * ic1eq + a3 * v3;
-		ic1eq = 2.0f * v1 - ic1eq;
-		ic2eq = 2.0f * v2 - ic2eq;
+void CytomicSVF::SetBlockSize(const int32 InNumFramesPerBlock)
+{
+	mBlockSize = InNumFramesPerBlock;
+
+	switch (InNumFramesPerBlock)
+	{
+	case ConsoleBlockSize:
+		mProcessModulatedBlock = &CytomicSVF::ProcessModulatedBlock<ConsoleBlockSize>;
+		mProcessFixedBlock = &CytomicSVF::ProcessFixedBlock<ConsoleBlockSize>;
+		break;
+
+	case DesktopBlockSize:
+		mProcessModulatedBlock = &CytomicSVF::ProcessModulatedBlock<DesktopBlockSize>;
+		mProcessFixedBlock = &CytomicSVF::ProcessFixedBlock<DesktopBlockSize>;
+		break;
 
-		OutBuffer[i] = m0 * OutBuffer[i] + m1 * k * v1 + m2 * v2;
+	default:
+		mProcessModulatedBlock = &CytomicSVF::ProcessModulatedBlock<0>;
+		mProcessFixedBlock = &CytomicSVF::ProcessFixedBlock<0>;
+		break;
 	}
 }
 
+void CytomicSVF::Reset()
+{
+	ic1eq = 0.0f;
+	ic2eq = 0.0f;
+}
+
 } //namespace DSPProcessing
\ No newline at end of file
@@ -0,0 +1,287 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "FIRConvolver.h"
+#include "AudioUtils.h"
+
+namespace DSPProcessing
+{
+	namespace FIRConvolverPrivate
+	{
+		// Measured partitioned convolution runs about twice as slow as its flop count suggests, mostly in the FFTs.
+		constexpr float FFTOverhead = 2.0f;
+
+		constexpr int32 MinPartitionSize = 64;
+		constexpr int32 MaxPartitionSize = 8192;
+
+		// Gain a transform applies relative to an unscaled forward FFT and a 1/N scaled inverse.
+		float GetScalingGain(const Audio::EFFTScaling InScaling, const int32 InFFTSize)
+		{
+			switch (InScaling)
+			{
+			case Audio::EFFTScaling::MultipliedByFFTSize:
+				return (float)InFFTSize;
+			case Audio::EFFTScaling::MultipliedBySqrtFFTSize:
+				return FMath::Sqrt((float)InFFTSize);
+			case Audio::EFFTScaling::DividedByFFTSize:
+				return 1.0f / InFFTSize;
+			case Audio::EFFTScaling::DividedBySqrtFFTSize:
+				return 1.0f / FMath::Sqrt((float)InFFTSize);
+			default:
+				return 1.0f;
+			}
+		}
+	}
+
+	float FFIRConvolver::GetDirectCost(const int32 InNumTaps)
+	{
+		// a multiply and an add per tap
+		return 2.0f * InNumTaps;
+	}
+
+	float FFIRConvolver::GetPartitionedCost(const int32 InNumTaps, const int32 InPartitionSize)
+	{
+		const int32 FFTSize = 2 * InPartitionSize;
+		const int32 NumPartitions = (InNumTaps + InPartitionSize - 1) / InPartitionSize;
+		const int32 NumBins = InPartitionSize + 1;
+
+		// a real FFT is about half of the 5 N log2 N of a complex one
+		const float TransformCost = 2.5f * FFTSize * FMath::Log2((float)FFTSize);
+		const float MultiplyAddCost = 8.0f * NumBins * NumPartitions;
+
+		return FIRConvolverPrivate::FFTOverhead * (2.0f * TransformCost + MultiplyAddCost) / InPartitionSize;
+	}
+
+	int32 FFIRConvolver::GetPartitionSize(const int32 InBlockSize)
+	{
+		return FMath::Clamp((int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Max(InBlockSize, 1)), FIRConvolverPrivate::MinPartitionSize, FIRConvolverPrivate::MaxPartitionSize);
+	}
+
+	EFIRMethod FFIRConvolver::ChooseMethod(const int32 InNumTaps, const int32 InBlockSize)
+	{
+		return GetPartitionedCost(InNumTaps, GetPartitionSize(InBlockSize)) < GetDirectCost(InNumTaps) ? EFIRMethod::Partitioned : EFIRMethod::Direct;
+	}
+
+	void FFIRConvolver::Init(const float* InTaps, const int32 InNumTaps, const int32 InBlockSize)
+	{
+		mNumTaps = FMath::Clamp(InNumTaps, 1, MaxNumTaps);
+		mMethod = ChooseMethod(mNumTaps, InBlockSize);
+
+		if (mMethod == EFIRMethod::Partitioned)
+		{
+			InitPartitioned(InTaps, InBlockSize);
+
+			// no FFT for this size on this platform
+			if (!mFFT.IsValid())
+			{
+				mMethod = EFIRMethod::Direct;
+			}
+		}
+
+		if (mMethod == EFIRMethod::Direct)
+		{
+			InitDirect(InTaps, InBlockSize);
+		}
+
+		Reset();
+	}
+
+	void FFIRConvolver::InitDirect(const float* InTaps, const int32 InBlockSize)
+	{
+		mLatency = 0;
+
+		mReversedTaps.SetNumUninitialized(mNumTaps);
+		for (int32 Tap = 0; Tap < mNumTaps; ++Tap)
+		{
+			mReversedTaps[Tap] = InTaps[mNumTaps - 1 - Tap];
+		}
+
+		// history is sized for the block passed to Init, longer blocks grow it on first use
+		mHistory.SetNumZeroed(mNumTaps - 1 + FMath::Max(InBlockSize, 1));
+	}
+
+	void FFIRConvolver::InitPartitioned(const float* InTaps, const int32 InBlockSize)
+	{
+		mPartitionSize = GetPartitionSize(InBlockSize);
+		mNumPartitions = (mNumTaps + mPartitionSize - 1) / mPartitionSize;
+		mLatency = (InBlockSize % mPartitionSize == 0) ? 0 : mPartitionSize;
+
+		const int32 FFTSize = 2 * mPartitionSize;
+
+		Audio::FFFTSettings Settings;
+		Settings.Log2Size = FMath::CeilLogTwo(FFTSize);
+		Settings.bArrays128BitAligned = true;
+		Settings.bEnableHardwareAcceleration = true;
+
+		mFFT = Audio::FFFTFactory::NewFFTAlgorithm(Settings);
+		if (!mFFT.IsValid())
+		{
+			return;
+		}
+
+		mSpectrumStride = (mFFT->NumOutputFloats() + 3) & ~3;
+
+		mFilterSpectra.SetNumZeroed(mNumPartitions * mSpectrumStride);
+		mInputSpectra.SetNumZeroed(mNumPartitions * mSpectrumStride);
+		mAccumulator.SetNumZeroed(mSpectrumStride);
+		mFFTInput.SetNumZeroed(FFTSize);
+		mFFTOutput.SetNumZeroed(FFTSize);
+
+		// undo whatever scaling the platform FFT applies, once, in the filter spectra
+		const float ForwardGain = FIRConvolverPrivate::GetScalingGain(mFFT->ForwardScaling(), FFTSize);
+		const float InverseGain = FIRConvolverPrivate::GetScalingGain(mFFT->InverseScaling(), FFTSize);
+		const float Scale = 1.0f / (ForwardGain * ForwardGain * InverseGain);
+
+		// each partition of the taps, zero padded to the FFT size
+		TArray<float> Padded;
+		Padded.SetNumZeroed(FFTSize);
+
+		for (int32 Partition = 0; Partition < mNumPartitions; ++Partition)
+		{
+			const int32 Start = Partition * mPartitionSize;
+			const int32 Count = FMath::Min(mPartitionSize, mNumTaps - Start);
+
+			FMemory::Memzero(Padded.GetData(), FFTSize * sizeof(float));
+			for (int32 Tap = 0; Tap < Count; ++Tap)
+			{
+				Padded[Tap] = InTaps[Start + Tap] * Scale;
+			}
+
+			mFFT->ForwardRealToComplex(Padded.GetData(), &mFilterSpectra[Partition * mSpectrumStride]);
+		}
+	}
+
+	void FFIRConvolver::Reset()
+	{
+		FMemory::Memzero(mHistory.GetData(), mHistory.Num() * sizeof(float));
+		FMemory::Memzero(mInputSpectra.GetData(), mInputSpectra.Num() * sizeof(float));
+		FMemory::Memzero(mFFTInput.GetData(), mFFTInput.Num() * sizeof(float));
+		FMemory::Memzero(mFFTOutput.GetData(), mFFTOutput.Num() * sizeof(float));
+
+		mInputSpectrumIndex = 0;
+		mPartitionFill = 0;
+	}
+
+	void FFIRConvolver::CopyHistoryFrom(const FFIRConvolver& InOther)
+	{
+		if (InOther.mMethod != mMethod)
+		{
+			return;
+		}
+
+		if (mMethod == EFIRMethod::Direct)
+		{
+			// the newest samples sit at the end of each history
+			const int32 NumToCopy = FMath::Min(mNumTaps, InOther.mNumTaps) - 1;
+			FMemory::Memcpy(&mHistory[mNumTaps - 1 - NumToCopy], &InOther.mHistory[InOther.mNumTaps - 1 - NumToCopy], NumToCopy * sizeof(float));
+			return;
+		}
+
+		if (InOther.mPartitionSize != mPartitionSize || InOther.mLatency != mLatency)
+		{
+			return;
+		}
+
+		// the pending output of the other filter is the right output for the input it has already been given
+		FMemory::Memcpy(mFFTInput.GetData(), InOther.mFFTInput.GetData(), mFFTInput.Num() * sizeof(float));
+		FMemory::Memcpy(mFFTOutput.GetData(), InOther.mFFTOutput.GetData(), mFFTOutput.Num() * sizeof(float));
+		mPartitionFill = InOther.mPartitionFill;
+
+		// newest input spectra first, laid out so the next partition is written after them
+		const int32 NumSpectra = FMath::Min(mNumPartitions, InOther.mNumPartitions);
+		for (int32 Spectrum = 0; Spectrum < NumSpectra; ++Spectrum)
+		{
+			const int32 OtherIndex = (InOther.mInputSpectrumIndex - 1 - Spectrum + InOther.mNumPartitions) % InOther.mNumPartitions;
+			FMemory::Memcpy(&mInputSpectra[(NumSpectra - 1 - Spectrum) * mSpectrumStride], &InOther.mInputSpectra[OtherIndex * mSpectrumStride], mSpectrumStride * sizeof(float));
+		}
+
+		mInputSpectrumIndex = NumSpectra % mNumPartitions;
+	}
+
+	void FFIRConvolver::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		if (mMethod == EFIRMethod::Partitioned)
+		{
+			ProcessPartitioned(InBuffer, OutBuffer, InNumSamples);
+		}
+		else
+		{
+			ProcessDirect(InBuffer, OutBuffer, InNumSamples);
+		}
+	}
+
+	void FFIRConvolver::ProcessDirect(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		const int32 NumHistory = mNumTaps - 1;
+
+		if (mHistory.Num() < NumHistory + InNumSamples)
+		{
+			mHistory.SetNumZeroed(NumHistory + InNumSamples);
+		}
+
+		float* History = mHistory.GetData();
+
+		// copying the block in first also makes in place processing safe
+		FMemory::Memcpy(&History[NumHistory], InBuffer, InNumSamples * sizeof(float));
+
+		ConvolveValid(History, mReversedTaps.GetData(), mNumTaps, OutBuffer, InNumSamples);
+
+		FMemory::Memmove(History, &History[InNumSamples], NumHistory * sizeof(float));
+	}
+
+	void FFIRConvolver::ProcessPartitioned(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		const float* NewestOutput = &mFFTOutput[mPartitionSize];
+
+		int32 Index = 0;
+		while (Index < InNumSamples)
+		{
+			const int32 NumToCopy = FMath::Min(InNumSamples - Index, mPartitionSize - mPartitionFill);
+
+			FMemory::Memcpy(&mFFTInput[mPartitionSize + mPartitionFill], &InBuffer[Index], NumToCopy * sizeof(float));
+
+			if (mLatency == 0)
+			{
+				// blocks are whole partitions, so each one can be convolved and returned straight away
+				ProcessPartition();
+				FMemory::Memcpy(&OutBuffer[Index], NewestOutput, NumToCopy * sizeof(float));
+			}
+			else
+			{
+				FMemory::Memcpy(&OutBuffer[Index], &NewestOutput[mPartitionFill], NumToCopy * sizeof(float));
+
+				mPartitionFill += NumToCopy;
+				if (mPartitionFill == mPartitionSize)
+				{
+					ProcessPartition();
+					mPartitionFill = 0;
+				}
+			}
+
+			Index += NumToCopy;
+		}
+	}
+
+	void FFIRConvolver::ProcessPartition()
+	{
+		float* InputSpectrum = &mInputSpectra[mInputSpectrumIndex * mSpectrumStride];
+		mFFT->ForwardRealToComplex(mFFTInput.GetData(), InputSpectrum);
+
+		// Y = sum over partitions j of X[newest - j] * H[j]
+		FMemory::Memzero(mAccumulator.GetData(), mSpectrumStride * sizeof(float));
+
+		int32 SpectrumIndex = mInputSpectrumIndex;
+		for (int32 Partition = 0; Partition < mNumPartitions; ++Partition)
+		{
+			ComplexMultiplyAdd(&mInputSpectra[SpectrumIndex * mSpectrumStride], &mFilterSpectra[Partition * mSpectrumStride], mAccumulator.GetData(), mSpectrumStride);
+			SpectrumIndex = SpectrumIndex == 0 ? mNumPartitions - 1 : SpectrumIndex - 1;
+		}
+
+		// overlap-save: the first half of the inverse is circular wrap around, the second half is valid output
+		mFFT->InverseComplexToReal(mAccumulator.GetData(), mFFTOutput.GetData());
+
+		FMemory::Memcpy(mFFTInput.GetData(), &mFFTInput[mPartitionSize], mPartitionSize * sizeof(float));
+		mInputSpectrumIndex = (mInputSpectrumIndex + 1) % mNumPartitions;
+	}
+
+} // namespace DSPProcessing
@@ -7,27 +7,39 @@
 
 namespace Metasound
 {
+	DEFINE_METASOUND_ENUM_BEGIN(DSPProcessing::EClickShape, FEnumClickShape, "ClickShape")
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EClickShape::Impulse, "ImpulseDescription", "Impulse", "ImpulseDescriptionTT", "A single sample at 1."),
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EClickShape::Doublet, "DoubletDescription", "Doublet", "DoubletDescriptionTT", "Width samples at 1 followed by Width samples at -1, with no DC offset."),
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EClickShape::Triangle, "TriangleDescription", "Triangle", "TriangleDescriptionTT", "A triangle 2 * Width - 1 samples long peaking at 1."),
+		DEFINE_METASOUND_ENUM_END()
 
 	namespace ClickNode
 	{
 		// Input params
 		METASOUND_PARAM(InputInClickNode, "In", "Trigger the 'click' signal");
+		METASOUND_PARAM(InputClickShape, "Shape", "The shape written at each trigger.");
+		METASOUND_PARAM(InputClickWidth, "Width", "Width of the Doublet and Triangle shapes in samples, from 1 to 256.");
 
 		// Output params
 		METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.");
 	} // namespace ClickNodeVertexNames
 
-	FClickNodeOperator::FClickNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn)
+	FClickNodeOperator::FClickNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn, const FEnumClickShapeReadRef& InShape, const FInt32ReadRef& InWidth)
 		: SampleRate(InSettings.GetSampleRate())
 		, TriggerIn(InTriggerIn)
+		, mShape(InShape)
+		, mWidth(InWidth)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
 	{
+		mClick.SetShape(*mShape, *mWidth);
 	}
 
 	void FClickNodeOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
 	{
 		using namespace ClickNode;
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputInClickNode), TriggerIn);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputClickShape), mShape);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputClickWidth), mWidth);
 	}
 
 	void FClickNodeOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -41,31 +53,41 @@ namespace Metasound
 		float* OutputAudio = AudioOutput->GetData();
 		const int32 NumSamples = AudioOutput->Num();
 
-		for (int samp = 0; samp < NumSamples; ++samp)
-		{
-			OutputAudio[samp] = 0.0f;
-		}
+		mClick.SetShape(*mShape, *mWidth);
+
+		// clears only the samples written last block instead of the whole buffer
+		mClick.BeginBlock(OutputAudio, NumSamples);
 
 		TriggerIn->ExecuteBlock(
 			[&](int32 StartFrame, int32 EndFrame)
 			{
 			},
-			[this, OutputAudio](int32 StartFrame, int32 EndFrame)
+			[this, OutputAudio, NumSamples](int32 StartFrame, int32 EndFrame)
 			{
-				OutputAudio[StartFrame] = 1.0f;
+				mClick.AddClick(OutputAudio, StartFrame, NumSamples);
 			}
 		);
 	}
 
+	void FClickNodeOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		mClick.Reset();
+	}
+
 	TUniquePtr<IOperator> FClickNodeOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
 	{
 		using namespace ClickNode;
 
 		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
 
-		FTriggerReadRef TriggerIn = InParams.InputData.ToDataReferenceCollection().GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InputInClickNode), InParams.OperatorSettings);
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FTriggerReadRef TriggerIn = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InputInClickNode), InParams.OperatorSettings);
+		FEnumClickShapeReadRef InShape = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumClickShape>(InputInterface, METASOUND_GET_PARAM_NAME(InputClickShape), InParams.OperatorSettings);
+		FInt32ReadRef InWidth = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InputClickWidth), InParams.OperatorSettings);
 
-		return MakeUnique<FClickNodeOperator>(InParams.OperatorSettings, InParams, TriggerIn);
+		return MakeUnique<FClickNodeOperator>(InParams.OperatorSettings, InParams, TriggerIn, InShape, InWidth);
 	}
 
 	const FVertexInterface& FClickNodeOperator::GetVertexInterface()
@@ -74,7 +96,9 @@ namespace Metasound
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
-				TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInClickNode))
+				TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInClickNode)),
+				TInputDataVertex<FEnumClickShape>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputClickShape), (int32)DSPProcessing::EClickShape::Impulse),
+				TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputClickWidth), 1)
 			),
 			FOutputVertexInterface(
 				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
@@ -92,7 +116,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Click"), TEXT("") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 1;
 				Info.DisplayName = LOCTEXT("Metasound_ClickNodeDisplayName", "Click");
 				Info.Description = LOCTEXT("Metasound_ClickNodeDescription", "Outputs a variety of 'click' signals for use in signal processing)");
 				Info.Author = "Chris Wratt";
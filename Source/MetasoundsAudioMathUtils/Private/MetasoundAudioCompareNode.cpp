@@ -37,7 +37,8 @@ namespace Metasound
 		, mInCompareComparator(InCompareComparator)
 		, mComparisonType(InComparisonTypeReadRef)
 	{
-		
+		InputCache.Init(InSettings.GetNumFramesPerBlock());
+		ComparatorCache.Init(InSettings.GetNumFramesPerBlock());
 	}
 
 	const FNodeClassMetadata& FCompareOperator::GetNodeInfo()
@@ -123,35 +124,199 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
-		switch (*mComparisonType)
+		// both caches must see every block, so evaluate them before combining
+		const bool bInputUnchanged = InputCache.MatchesPrevious(InputAudio, NumSamples);
+		const bool bComparatorUnchanged = ComparatorCache.MatchesPrevious(InputCompareComparator, NumSamples);
+		const EAudioComparisonType ComparisonType = *mComparisonType;
+		const bool bTypeUnchanged = mPreviousComparisonType == ComparisonType;
+		mPreviousComparisonType = ComparisonType;
+
+		if (bInputUnchanged && bComparatorUnchanged && bTypeUnchanged)
+		{
+			return;
+		}
+
+		Compare(ComparisonType, InputAudio, InputCompareComparator, OutputAudio, NumSamples);
+	}
+
+	void FCompareOperator::Compare(const EAudioComparisonType InComparisonType, const float* InBuffer, const float* InComparator, float* OutBuffer, const int32 InNumSamples)
+	{
+		switch (InComparisonType)
 		{
 		case EAudioComparisonType::Equals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] == InputCompareComparator[Index];
+			for (int32 Index = 0; Index < InNumSamples; ++Index) OutBuffer[Index] = InBuffer[Index] == InComparator[Index];
 			break;
 
 		case EAudioComparisonType::NotEquals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] != InputCompareComparator[Index];
+			for (int32 Index = 0; Index < InNumSamples; ++Index) OutBuffer[Index] = InBuffer[Index] != InComparator[Index];
 			break;
 
 		case EAudioComparisonType::LessThan:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] < InputCompareComparator[Index];
+			for (int32 Index = 0; Index < InNumSamples; ++Index) OutBuffer[Index] = InBuffer[Index] < InComparator[Index];
 			break;
 
 		case EAudioComparisonType::GreaterThan:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] > InputCompareComparator[Index];
+			for (int32 Index = 0; Index < InNumSamples; ++Index) OutBuffer[Index] = InBuffer[Index] > InComparator[Index];
 			break;
 
 		case EAudioComparisonType::LessThanOrEquals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] <= InputCompareComparator[Index];
+			for (int32 Index = 0; Index < InNumSamples; ++Index) OutBuffer[Index] = InBuffer[Index] <= InComparator[Index];
 			break;
 
 		case EAudioComparisonType::GreaterThanOrEquals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] >= InputCompareComparator[Index];
+			for (int32 Index = 0; Index < InNumSamples; ++Index) OutBuffer[Index] = InBuffer[Index] >= InComparator[Index];
 			break;
 		}
 	}
 
+	void FCompareOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		InputCache.Invalidate();
+		ComparatorCache.Invalidate();
+	}
+
+	//------------------------------------------------------------------------------------
+	// TMultichannelCompareOperator
+	//------------------------------------------------------------------------------------
+	template<int32 NumChannels>
+	TMultichannelCompareOperator<NumChannels>::TMultichannelCompareOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FAudioBufferReadRef& InCompareComparator, const FEnumAudioCompareTypeReadRef& InComparisonType)
+		: AudioInputs(InAudioInputs)
+		, mInCompareComparator(InCompareComparator)
+		, mComparisonType(InComparisonType)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+			InputCaches[Channel].Init(InSettings.GetNumFramesPerBlock());
+		}
+
+		ComparatorCache.Init(InSettings.GetNumFramesPerBlock());
+	}
+
+	template<int32 NumChannels>
+	const FNodeClassMetadata& TMultichannelCompareOperator<NumChannels>::GetNodeInfo()
+	{
+		static const FNodeClassMetadata Info = MultichannelAudioMath::MakeNodeInfo(FCompareOperator::GetNodeInfo(), NumChannels, GetVertexInterface());
+		return Info;
+	}
+
+	template<int32 NumChannels>
+	const FVertexInterface& TMultichannelCompareOperator<NumChannels>::GetVertexInterface()
+	{
+		using namespace CompareNode;
+
+		static const FVertexInterface Interface = MultichannelAudioMath::MakeVertexInterface(FCompareOperator::GetVertexInterface(), METASOUND_GET_PARAM_NAME(InParamNameAudioInput), METASOUND_GET_PARAM_NAME(OutParamNameAudio), NumChannels);
+		return Interface;
+	}
+
+	template<int32 NumChannels>
+	FVertexName TMultichannelCompareOperator<NumChannels>::GetInputName(const int32 InChannel)
+	{
+		using namespace CompareNode;
+
+		return MultichannelAudioMath::MakeChannelVertexName(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), NumChannels, InChannel);
+	}
+
+	template<int32 NumChannels>
+	FVertexName TMultichannelCompareOperator<NumChannels>::GetOutputName(const int32 InChannel)
+	{
+		using namespace CompareNode;
+
+		return MultichannelAudioMath::MakeChannelVertexName(METASOUND_GET_PARAM_NAME(OutParamNameAudio), NumChannels, InChannel);
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelCompareOperator<NumChannels>::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace CompareNode;
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			InOutVertexData.BindReadVertex(GetInputName(Channel), AudioInputs[Channel]);
+		}
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameCompareComparator), mInCompareComparator);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputCompareType), mComparisonType);
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelCompareOperator<NumChannels>::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			InOutVertexData.BindReadVertex(GetOutputName(Channel), AudioOutputs[Channel]);
+		}
+	}
+
+	template<int32 NumChannels>
+	TUniquePtr<IOperator> TMultichannelCompareOperator<NumChannels>::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace CompareNode;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		TArray<FAudioBufferReadRef> AudioIns;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioIns.Add(InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(GetInputName(Channel), InParams.OperatorSettings));
+		}
+
+		FAudioBufferReadRef InCompareComparator = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameCompareComparator), InParams.OperatorSettings);
+		FEnumAudioCompareTypeReadRef InComparison = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumAudioCompareType>(InputInterface, METASOUND_GET_PARAM_NAME(InputCompareType), InParams.OperatorSettings);
+
+		return MakeUnique<TMultichannelCompareOperator<NumChannels>>(InParams.OperatorSettings, AudioIns, InCompareComparator, InComparison);
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelCompareOperator<NumChannels>::Execute()
+	{
+		const float* InputCompareComparator = mInCompareComparator->GetData();
+		const int32 NumSamples = AudioInputs[0]->Num();
+
+		// every cache must see every block, so evaluate them all before combining
+		const bool bComparatorUnchanged = ComparatorCache.MatchesPrevious(InputCompareComparator, NumSamples);
+		const EAudioComparisonType ComparisonType = *mComparisonType;
+		const bool bTypeUnchanged = mPreviousComparisonType == ComparisonType;
+		mPreviousComparisonType = ComparisonType;
+
+		bool bProcessChannel[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			const bool bInputUnchanged = InputCaches[Channel].MatchesPrevious(AudioInputs[Channel]->GetData(), NumSamples);
+			bProcessChannel[Channel] = !(bInputUnchanged && bComparatorUnchanged && bTypeUnchanged);
+		}
+
+		for (int32 Offset = 0; Offset < NumSamples; Offset += MultichannelAudioMath::ChunkSize)
+		{
+			const int32 NumChunkSamples = FMath::Min(MultichannelAudioMath::ChunkSize, NumSamples - Offset);
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				if (bProcessChannel[Channel])
+				{
+					FCompareOperator::Compare(ComparisonType, &AudioInputs[Channel]->GetData()[Offset], &InputCompareComparator[Offset], &AudioOutputs[Channel]->GetData()[Offset], NumChunkSamples);
+				}
+			}
+		}
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelCompareOperator<NumChannels>::Reset(const IOperator::FResetParams& InParams)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioOutputs[Channel]->Zero();
+			InputCaches[Channel].Invalidate();
+		}
+
+		ComparatorCache.Invalidate();
+	}
+
 	METASOUND_REGISTER_NODE(FCompareNode)
+	METASOUND_REGISTER_NODE(FCompareStereoNode)
+	METASOUND_REGISTER_NODE(FCompareQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
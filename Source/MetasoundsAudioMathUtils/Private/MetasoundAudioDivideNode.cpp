@@ -20,15 +20,7 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FAudioDivideOperator
 	//------------------------------------------------------------------------------------
-	FAudioDivideOperator::FAudioDivideOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InAudioDivide)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-		, mInAudioDivide(InAudioDivide)
-	{
-
-	}
-
-	const FNodeClassMetadata& FAudioDivideOperator::GetNodeInfo()
+	const FNodeClassMetadata& FAudioDivideNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -52,22 +44,7 @@ namespace Metasound
 		return Info;
 	}
 
-	void FAudioDivideOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace AudioDivideNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioDivide), mInAudioDivide);
-	}
-
-	void FAudioDivideOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace AudioDivideNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FAudioDivideOperator::GetVertexInterface()
+	const FVertexInterface& FAudioDivideNodeOp::GetVertexInterface()
 	{
 		using namespace AudioDivideNode;
 
@@ -85,32 +62,30 @@ namespace Metasound
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FAudioDivideOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FAudioDivideNodeOp::GetInputName()
 	{
 		using namespace AudioDivideNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
-
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
-		FAudioBufferReadRef InAudioDivide = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioDivide), InParams.OperatorSettings);
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
+	}
 
+	FVertexName FAudioDivideNodeOp::GetOperandName()
+	{
+		using namespace AudioDivideNode;
 
-		return MakeUnique<FAudioDivideOperator>(InParams.OperatorSettings, AudioIn, InAudioDivide);
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioDivide);
 	}
 
-	void FAudioDivideOperator::Execute()
+	FVertexName FAudioDivideNodeOp::GetOutputName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
-		const float* InputAudioDivide = mInAudioDivide->GetData();
-
-		const int32 NumSamples = AudioInput->Num();
+		using namespace AudioDivideNode;
 
-		AudioDivideDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputAudioDivide, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
 	METASOUND_REGISTER_NODE(FAudioDivideNode)
+	METASOUND_REGISTER_NODE(FAudioDivideStereoNode)
+	METASOUND_REGISTER_NODE(FAudioDivideQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,18 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundAudioMathOperator.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_AudioMathOperator"
+
+namespace Metasound
+{
+	DEFINE_METASOUND_ENUM_BEGIN(DSPProcessing::EAntiAliasing, FEnumAntiAliasing, "AntiAliasing")
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EAntiAliasing::None, "NoneDescription", "None", "NoneDescriptionTT", "The plain kernel, no added latency."),
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EAntiAliasing::Oversample2x, "Oversample2xDescription", "Oversample 2x", "Oversample2xDescriptionTT", "Runs the kernel at twice the sample rate between halfband filters. Adds 31 samples of latency."),
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EAntiAliasing::Oversample4x, "Oversample4xDescription", "Oversample 4x", "Oversample4xDescriptionTT", "Runs the kernel at four times the sample rate. Adds 36.5 samples of latency."),
+		DEFINE_METASOUND_ENUM_ENTRY(DSPProcessing::EAntiAliasing::Antiderivative, "AntiderivativeDescription", "Antiderivative (ADAA)", "AntiderivativeDescriptionTT", "First-order antiderivative anti-aliasing: much cheaper than oversampling, less effective at high frequencies. Adds half a sample of latency."),
+		DEFINE_METASOUND_ENUM_END()
+}
+
+#undef LOCTEXT_NAMESPACE
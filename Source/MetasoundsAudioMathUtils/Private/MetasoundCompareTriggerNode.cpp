@@ -0,0 +1,141 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundCompareTriggerNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_CompareTriggerNode"
+
+namespace Metasound
+{
+
+	namespace CompareTriggerNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.");
+		METASOUND_PARAM(InParamNameThreshold, "Threshold", "The value the input is compared against.");
+		METASOUND_PARAM(InParamNameHysteresis, "Hysteresis", "Width of the band around the threshold the input has to cross before the state changes again.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameOnRise, "On Rise", "Triggers when the input rises above Threshold + Hysteresis / 2.");
+		METASOUND_PARAM(OutParamNameOnFall, "On Fall", "Triggers when the input falls below Threshold - Hysteresis / 2.");
+	} // namespace CompareTriggerNode
+
+	FCompareTriggerOperator::FCompareTriggerOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FFloatReadRef& InThreshold, const FFloatReadRef& InHysteresis)
+		: AudioInput(InAudioInput)
+		, mThreshold(InThreshold)
+		, mHysteresis(InHysteresis)
+		, mOnRise(FTriggerWriteRef::CreateNew(InSettings))
+		, mOnFall(FTriggerWriteRef::CreateNew(InSettings))
+	{
+	}
+
+	void FCompareTriggerOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace CompareTriggerNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameThreshold), mThreshold);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameHysteresis), mHysteresis);
+	}
+
+	void FCompareTriggerOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace CompareTriggerNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameOnRise), mOnRise);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameOnFall), mOnFall);
+	}
+
+	void FCompareTriggerOperator::Execute()
+	{
+		mOnRise->AdvanceBlock();
+		mOnFall->AdvanceBlock();
+
+		const float* InputAudio = AudioInput->GetData();
+		const int32 NumSamples = AudioInput->Num();
+
+		mSchmittTrigger.SetThreshold(*mThreshold, *mHysteresis);
+
+		// only the frames around each edge are visited individually
+		bool bIsRising = false;
+		int32 Frame = mSchmittTrigger.FindNextEdge(InputAudio, 0, NumSamples, bIsRising);
+		while (Frame < NumSamples)
+		{
+			if (bIsRising)
+			{
+				mOnRise->TriggerFrame(Frame);
+			}
+			else
+			{
+				mOnFall->TriggerFrame(Frame);
+			}
+
+			Frame = mSchmittTrigger.FindNextEdge(InputAudio, Frame + 1, NumSamples, bIsRising);
+		}
+	}
+
+	void FCompareTriggerOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		mOnRise->Reset();
+		mOnFall->Reset();
+		mSchmittTrigger.Reset();
+	}
+
+	TUniquePtr<IOperator> FCompareTriggerOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace CompareTriggerNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FFloatReadRef InThreshold = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameThreshold), InParams.OperatorSettings);
+		FFloatReadRef InHysteresis = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameHysteresis), InParams.OperatorSettings);
+
+		return MakeUnique<FCompareTriggerOperator>(InParams.OperatorSettings, AudioIn, InThreshold, InHysteresis);
+	}
+
+	const FVertexInterface& FCompareTriggerOperator::GetVertexInterface()
+	{
+		using namespace CompareTriggerNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameThreshold), 0.0f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameHysteresis), 0.0f)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameOnRise)),
+				TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameOnFall))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FCompareTriggerOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Compare Trigger (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_CompareTriggerDisplayName", "Compare Trigger (Audio)");
+				Info.Description = LOCTEXT("Metasound_CompareTriggerNodeDescription", "Schmitt trigger: triggers when the input rises above or falls below a threshold, with optional hysteresis.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_CompareTriggerNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FCompareTriggerNode)
+}
+
+#undef LOCTEXT_NAMESPACE
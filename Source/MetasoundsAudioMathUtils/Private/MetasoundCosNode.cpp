@@ -18,14 +18,7 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FCosOperator
 	//------------------------------------------------------------------------------------
-	FCosOperator::FCosOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-	{
-
-	}
-
-	const FNodeClassMetadata& FCosOperator::GetNodeInfo()
+	const FNodeClassMetadata& FCosNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -49,21 +42,7 @@ namespace Metasound
 		return Info;
 	}
 
-	void FCosOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace CosNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-	}
-
-	void FCosOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace CosNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FCosOperator::GetVertexInterface()
+	const FVertexInterface& FCosNodeOp::GetVertexInterface()
 	{
 		using namespace CosNode;
 
@@ -79,29 +58,23 @@ namespace Metasound
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FCosOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FCosNodeOp::GetInputName()
 	{
 		using namespace CosNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
-
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
-
-		return MakeUnique<FCosOperator>(InParams.OperatorSettings, AudioIn);
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
 	}
 
-	void FCosOperator::Execute()
+	FVertexName FCosNodeOp::GetOutputName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
-
-		const int32 NumSamples = AudioInput->Num();
+		using namespace CosNode;
 
-		CosDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
 	METASOUND_REGISTER_NODE(FCosNode)
+	METASOUND_REGISTER_NODE(FCosStereoNode)
+	METASOUND_REGISTER_NODE(FCosQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,145 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundExprNode.h"
+#include "AudioUtils.h"
+#include "MetasoundsAudioMathUtils.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_ExprNode"
+
+namespace Metasound
+{
+	namespace ExprNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameExpression, "Expression", "Expression over x, y, z and w, e.g. sqrt(pow(x, 2) * z) / y. Compiled when the MetaSound is built.")
+			METASOUND_PARAM(InParamNameX, "x", "Audio input x.")
+			METASOUND_PARAM(InParamNameY, "y", "Audio input y.")
+			METASOUND_PARAM(InParamNameZ, "z", "Audio input z.")
+			METASOUND_PARAM(InParamNameW, "w", "Audio input w.")
+
+			// Output params
+			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+	}
+
+	//------------------------------------------------------------------------------------
+	// FExprOperator
+	//------------------------------------------------------------------------------------
+	FExprOperator::FExprOperator(const FOperatorSettings& InSettings, const FStringReadRef& InExpression, const FAudioBufferReadRef& InX, const FAudioBufferReadRef& InY, const FAudioBufferReadRef& InZ, const FAudioBufferReadRef& InW)
+		: mExpression(InExpression)
+		, mInX(InX)
+		, mInY(InY)
+		, mInZ(InZ)
+		, mInW(InW)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+	{
+		FString Error;
+		if (!Expression.Compile(*mExpression, Error))
+		{
+			UE_LOG(LogMetasoundsAudioMathUtils, Warning, TEXT("Expr (Audio): '%s' failed to compile, %s. Output will be silent."), **mExpression, *Error);
+		}
+	}
+
+	const FNodeClassMetadata& FExprOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Expr (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_ExprDisplayName", "Expr (Audio)");
+				Info.Description = LOCTEXT("Metasound_ExprNodeDescription", "Evaluates an expression over up to four audio inputs in a single pass. Supports + - * / < > <= >= == != and sin, cos, sqrt, pow, wrap, gate, abs, min, max.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_ExprNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	void FExprOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace ExprNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameExpression), mExpression);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameX), mInX);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameY), mInY);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameZ), mInZ);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameW), mInW);
+	}
+
+	void FExprOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace ExprNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	const FVertexInterface& FExprOperator::GetVertexInterface()
+	{
+		using namespace ExprNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameExpression), FString(TEXT("x"))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameX)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameY)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameZ)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameW))
+			),
+
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	TUniquePtr<IOperator> FExprOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace ExprNode;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		FStringReadRef InExpression = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameExpression), InParams.OperatorSettings);
+		FAudioBufferReadRef InX = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameX), InParams.OperatorSettings);
+		FAudioBufferReadRef InY = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameY), InParams.OperatorSettings);
+		FAudioBufferReadRef InZ = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameZ), InParams.OperatorSettings);
+		FAudioBufferReadRef InW = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameW), InParams.OperatorSettings);
+
+		return MakeUnique<FExprOperator>(InParams.OperatorSettings, InExpression, InX, InY, InZ, InW);
+	}
+
+	void FExprOperator::Execute()
+	{
+		const float* Inputs[DSPProcessing::FAudioExpression::MaxInputs] = { mInX->GetData(), mInY->GetData(), mInZ->GetData(), mInW->GetData() };
+		float* OutputAudio = AudioOutput->GetData();
+
+		const int32 NumSamples = AudioOutput->Num();
+
+		Expression.ProcessAudioBuffer(Inputs, OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+		DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("Expr (Audio)"));
+#endif
+	}
+
+	void FExprOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		Expression.Reset();
+	}
+
+	METASOUND_REGISTER_NODE(FExprNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,181 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundFIRNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_FIRNode"
+
+namespace Metasound
+{
+
+	namespace FIRNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.");
+		METASOUND_PARAM(InParamNameTaps, "Taps", "Impulse response, first tap is the undelayed input. Empty passes the input through, taps past the 4096th are ignored.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameAudio, "Out", "Filtered audio output.");
+		METASOUND_PARAM(OutParamNameLatency, "Latency", "Delay added on top of the filter's own response. Only non zero for long filters with block sizes that are not a power of two.");
+	} // namespace FIRNode
+
+	FFIROperator::FFIROperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const TDataReadReference<TArray<float>>& InTaps)
+		: AudioInput(InAudioInput)
+		, mTaps(InTaps)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mLatency(FTimeWriteRef::CreateNew())
+		, BlockSize(InSettings.GetNumFramesPerBlock())
+		, SampleRate(InSettings.GetSampleRate())
+		, mConvolverDesigner([LocalBlockSize = InSettings.GetNumFramesPerBlock()](DSPProcessing::FFIRConvolver& OutConvolver, const TArray<float>& InTaps)
+			{
+				InitConvolver(OutConvolver, InTaps, LocalBlockSize);
+			})
+	{
+		// Room for the longest filter in the comparison copy and the designer's three request slots, 64 KiB in all,
+		// so changing the taps never allocates on the audio thread.
+		mRequestedTaps.Reserve(MaxTaps);
+		mConvolverDesigner.InitParams([](TArray<float>& OutTaps)
+			{
+				OutTaps.Reserve(MaxTaps);
+			});
+
+		// the operator is built off the audio thread, so the first convolver can be built in place
+		const TArrayView<const float> Taps = GetTaps();
+		mRequestedTaps.Append(Taps.GetData(), Taps.Num());
+		mConvolverDesigner.DesignNow(mRequestedTaps);
+		UpdateLatency();
+	}
+
+	void FFIROperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace FIRNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameTaps), mTaps);
+	}
+
+	void FFIROperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace FIRNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameLatency), mLatency);
+	}
+
+	TArrayView<const float> FFIROperator::GetTaps() const
+	{
+		return MakeArrayView(mTaps->GetData(), FMath::Min(mTaps->Num(), MaxTaps));
+	}
+
+	void FFIROperator::UpdateTaps()
+	{
+		// Comparing is one pass over the taps a block, next to the convolution's pass over them for every sample.
+		const TArrayView<const float> Taps = GetTaps();
+		if (Taps.Num() != mRequestedTaps.Num() || FMemory::Memcmp(Taps.GetData(), mRequestedTaps.GetData(), Taps.Num() * sizeof(float)) != 0)
+		{
+			// Choosing the method and transforming the taps happens on the design worker; the current convolver
+			// keeps running until the new one arrives. The copies fit in the space reserved at construction.
+			mRequestedTaps.Reset();
+			mRequestedTaps.Append(Taps.GetData(), Taps.Num());
+			mConvolverDesigner.RequestDesign([&Taps](TArray<float>& OutTaps)
+				{
+					OutTaps.Reset();
+					OutTaps.Append(Taps.GetData(), Taps.Num());
+				});
+		}
+
+		if (mConvolverDesigner.Update())
+		{
+			mConvolverDesigner.GetCurrent()->CopyHistoryFrom(*mConvolverDesigner.GetReplaced());
+			UpdateLatency();
+		}
+	}
+
+	void FFIROperator::InitConvolver(DSPProcessing::FFIRConvolver& OutConvolver, const TArray<float>& InTaps, const int32 InBlockSize)
+	{
+		if (InTaps.Num() == 0)
+		{
+			const float UnitImpulse = 1.0f;
+			OutConvolver.Init(&UnitImpulse, 1, InBlockSize);
+		}
+		else
+		{
+			OutConvolver.Init(InTaps.GetData(), InTaps.Num(), InBlockSize);
+		}
+	}
+
+	void FFIROperator::UpdateLatency()
+	{
+		*mLatency = FTime((double)mConvolverDesigner.GetCurrent()->GetLatency() / SampleRate);
+	}
+
+	void FFIROperator::Execute()
+	{
+		UpdateTaps();
+
+		mConvolverDesigner.GetCurrent()->ProcessAudioBuffer(AudioInput->GetData(), AudioOutput->GetData(), AudioInput->Num());
+	}
+
+	void FFIROperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		mConvolverDesigner.GetCurrent()->Reset();
+		UpdateTaps();
+	}
+
+	TUniquePtr<IOperator> FFIROperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace FIRNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		TDataReadReference<TArray<float>> InTaps = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<TArray<float>>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameTaps), InParams.OperatorSettings);
+
+		return MakeUnique<FFIROperator>(InParams.OperatorSettings, AudioIn, InTaps);
+	}
+
+	const FVertexInterface& FFIROperator::GetVertexInterface()
+	{
+		using namespace FIRNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<TArray<float>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameTaps))
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio)),
+				TOutputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameLatency))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FFIROperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("FIR (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_FIRDisplayName", "FIR (Audio)");
+				Info.Description = LOCTEXT("Metasound_FIRNodeDescription", "Convolves the input with an arbitrary impulse response. Short filters run directly with SIMD, long ones switch to partitioned FFT convolution; the choice is made whenever the taps change.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_FIRNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FFIRNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,148 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundFeedbackExprNode.h"
+#include "AudioUtils.h"
+#include "MetasoundsAudioMathUtils.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_FeedbackExprNode"
+
+namespace Metasound
+{
+	namespace FeedbackExprNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameExpression, "Expression", "Optional assignments to the single sample delay registers s0..s3 followed by the output expression, e.g. s0 = s0 * 0.99 + x * 0.01; s0. Compiled when the MetaSound is built.")
+			METASOUND_PARAM(InParamNameX, "x", "Audio input x.")
+			METASOUND_PARAM(InParamNameY, "y", "Audio input y.")
+			METASOUND_PARAM(InParamNameZ, "z", "Audio input z.")
+			METASOUND_PARAM(InParamNameW, "w", "Audio input w.")
+
+			// Output params
+			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+	}
+
+	//------------------------------------------------------------------------------------
+	// FFeedbackExprOperator
+	//------------------------------------------------------------------------------------
+	FFeedbackExprOperator::FFeedbackExprOperator(const FOperatorSettings& InSettings, const FStringReadRef& InExpression, const FAudioBufferReadRef& InX, const FAudioBufferReadRef& InY, const FAudioBufferReadRef& InZ, const FAudioBufferReadRef& InW)
+		: mExpression(InExpression)
+		, mInX(InX)
+		, mInY(InY)
+		, mInZ(InZ)
+		, mInW(InW)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+	{
+		FString Error;
+		if (!Expression.Compile(*mExpression, Error, true))
+		{
+			UE_LOG(LogMetasoundsAudioMathUtils, Warning, TEXT("Feedback Expr (Audio): '%s' failed to compile, %s. Output will be silent."), **mExpression, *Error);
+		}
+	}
+
+	const FNodeClassMetadata& FFeedbackExprOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Feedback Expr (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_FeedbackExprDisplayName", "Feedback Expr (Audio)");
+				Info.Description = LOCTEXT("Metasound_FeedbackExprNodeDescription", "Runs an expression once per sample with single sample feedback through the s0..s3 registers, for custom filters and chaotic oscillators without lowering the graph block size. Same operators and functions as Expr (Audio).");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_FeedbackExprNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	void FFeedbackExprOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace FeedbackExprNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameExpression), mExpression);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameX), mInX);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameY), mInY);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameZ), mInZ);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameW), mInW);
+	}
+
+	void FFeedbackExprOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace FeedbackExprNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	const FVertexInterface& FFeedbackExprOperator::GetVertexInterface()
+	{
+		using namespace FeedbackExprNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameExpression), FString(TEXT("s0 = x; s0"))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameX)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameY)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameZ)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameW))
+			),
+
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	TUniquePtr<IOperator> FFeedbackExprOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace FeedbackExprNode;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		FStringReadRef InExpression = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameExpression), InParams.OperatorSettings);
+		FAudioBufferReadRef InX = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameX), InParams.OperatorSettings);
+		FAudioBufferReadRef InY = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameY), InParams.OperatorSettings);
+		FAudioBufferReadRef InZ = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameZ), InParams.OperatorSettings);
+		FAudioBufferReadRef InW = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameW), InParams.OperatorSettings);
+
+		return MakeUnique<FFeedbackExprOperator>(InParams.OperatorSettings, InExpression, InX, InY, InZ, InW);
+	}
+
+	void FFeedbackExprOperator::Execute()
+	{
+		const float* Inputs[DSPProcessing::FAudioExpression::MaxInputs] = { mInX->GetData(), mInY->GetData(), mInZ->GetData(), mInW->GetData() };
+		float* OutputAudio = AudioOutput->GetData();
+
+		const int32 NumSamples = AudioOutput->Num();
+
+		Expression.ProcessAudioBufferPerSample(Inputs, OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+		if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("Feedback Expr (Audio)")))
+		{
+			Expression.Reset();
+		}
+#endif
+	}
+
+	void FFeedbackExprOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		Expression.Reset();
+	}
+
+	METASOUND_REGISTER_NODE(FFeedbackExprNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -20,15 +20,7 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FGateOperator
 	//------------------------------------------------------------------------------------
-	FGateOperator::FGateOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InGateToggle)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-		, mInGateToggle(InGateToggle)
-	{
-
-	}
-
-	const FNodeClassMetadata& FGateOperator::GetNodeInfo()
+	const FNodeClassMetadata& FGateNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -52,22 +44,7 @@ namespace Metasound
 		return Info;
 	}
 
-	void FGateOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace GateNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameGateToggle), mInGateToggle);
-	}
-
-	void FGateOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace GateNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FGateOperator::GetVertexInterface()
+	const FVertexInterface& FGateNodeOp::GetVertexInterface()
 	{
 		using namespace GateNode;
 
@@ -85,32 +62,30 @@ namespace Metasound
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FGateOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FGateNodeOp::GetInputName()
 	{
 		using namespace GateNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
-
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
-		FAudioBufferReadRef InGateToggle = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameGateToggle), InParams.OperatorSettings);
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
+	}
 
+	FVertexName FGateNodeOp::GetOperandName()
+	{
+		using namespace GateNode;
 
-		return MakeUnique<FGateOperator>(InParams.OperatorSettings, AudioIn, InGateToggle);
+		return METASOUND_GET_PARAM_NAME(InParamNameGateToggle);
 	}
 
-	void FGateOperator::Execute()
+	FVertexName FGateNodeOp::GetOutputName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
-		const float* InputGateToggle = mInGateToggle->GetData();
-
-		const int32 NumSamples = AudioInput->Num();
+		using namespace GateNode;
 
-		GateDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputGateToggle, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
 	METASOUND_REGISTER_NODE(FGateNode)
+	METASOUND_REGISTER_NODE(FGateStereoNode)
+	METASOUND_REGISTER_NODE(FGateQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,101 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundMultichannelAudioMathOperator.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_MultichannelAudioMathOperator"
+
+namespace Metasound
+{
+	namespace MultichannelAudioMath
+	{
+		FString GetChannelName(const int32 InNumChannels, const int32 InChannel)
+		{
+			static const TCHAR* StereoNames[] = { TEXT("L"), TEXT("R") };
+			static const TCHAR* QuadNames[] = { TEXT("FL"), TEXT("FR"), TEXT("BL"), TEXT("BR") };
+
+			if (InNumChannels == 2)
+			{
+				return StereoNames[InChannel];
+			}
+
+			if (InNumChannels == 4)
+			{
+				return QuadNames[InChannel];
+			}
+
+			return FString::FromInt(InChannel);
+		}
+
+		FVertexName MakeChannelVertexName(const FVertexName& InMonoName, const int32 InNumChannels, const int32 InChannel)
+		{
+			return FVertexName(*FString::Printf(TEXT("%s %s"), *InMonoName.ToString(), *GetChannelName(InNumChannels, InChannel)));
+		}
+
+		FVertexInterface MakeVertexInterface(const FVertexInterface& InMonoInterface, const FVertexName& InMonoInputName, const FVertexName& InMonoOutputName, const int32 InNumChannels)
+		{
+			// the mono tooltip, shown under the channel's own name
+			auto MakeChannelMetadata = [](const FDataVertexMetadata& InMonoMetadata, const FVertexName& InChannelName)
+				{
+					FDataVertexMetadata Metadata = InMonoMetadata;
+					Metadata.DisplayName = FText::FromName(InChannelName);
+					return Metadata;
+				};
+
+			FInputVertexInterface Inputs;
+			for (const FInputDataVertex& Vertex : InMonoInterface.GetInputInterface())
+			{
+				if (Vertex.VertexName != InMonoInputName)
+				{
+					Inputs.Add(Vertex);
+					continue;
+				}
+
+				for (int32 Channel = 0; Channel < InNumChannels; ++Channel)
+				{
+					const FVertexName ChannelName = MakeChannelVertexName(InMonoInputName, InNumChannels, Channel);
+					Inputs.Add(TInputDataVertex<FAudioBuffer>(ChannelName, MakeChannelMetadata(Vertex.Metadata, ChannelName)));
+				}
+			}
+
+			FOutputVertexInterface Outputs;
+			for (const FOutputDataVertex& Vertex : InMonoInterface.GetOutputInterface())
+			{
+				if (Vertex.VertexName != InMonoOutputName)
+				{
+					Outputs.Add(Vertex);
+					continue;
+				}
+
+				for (int32 Channel = 0; Channel < InNumChannels; ++Channel)
+				{
+					const FVertexName ChannelName = MakeChannelVertexName(InMonoOutputName, InNumChannels, Channel);
+					Outputs.Add(TOutputDataVertex<FAudioBuffer>(ChannelName, MakeChannelMetadata(Vertex.Metadata, ChannelName)));
+				}
+			}
+
+			return FVertexInterface(Inputs, Outputs);
+		}
+
+		FNodeClassMetadata MakeNodeInfo(const FNodeClassMetadata& InMonoInfo, const int32 InNumChannels, const FVertexInterface& InInterface)
+		{
+			const FText LayoutName = InNumChannels == 2 ? LOCTEXT("Metasound_StereoLayout", "Stereo")
+				: InNumChannels == 4 ? LOCTEXT("Metasound_QuadLayout", "Quad")
+				: FText::AsNumber(InNumChannels);
+
+			// class names are never localized
+			const FName Variant = InNumChannels == 2 ? FName(TEXT("Stereo")) : InNumChannels == 4 ? FName(TEXT("Quad")) : FName(*FString::FromInt(InNumChannels));
+
+			FNodeClassMetadata Info = InMonoInfo;
+
+			Info.ClassName = { InMonoInfo.ClassName.GetNamespace(), InMonoInfo.ClassName.GetName(), Variant };
+			Info.DisplayName = FText::Format(LOCTEXT("Metasound_MultichannelDisplayName", "{1} {0}"), InMonoInfo.DisplayName, LayoutName);
+			Info.Description = FText::Format(LOCTEXT("Metasound_MultichannelDescription", "{0} Processes every channel in one node; the other inputs are shared by all channels."), InMonoInfo.Description);
+			Info.DefaultInterface = InInterface;
+
+			return Info;
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
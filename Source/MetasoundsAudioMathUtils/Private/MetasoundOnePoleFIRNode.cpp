@@ -27,7 +27,7 @@ namespace Metasound
 		, mCoefficientB(InCoefficientB)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
 	{
-
+		OnePoleFIRDSPProcessor.SetBlockSize(InSettings.GetNumFramesPerBlock());
 	}
 
 	const FNodeClassMetadata& FOnePoleFIROperator::GetNodeInfo()
@@ -113,6 +113,19 @@ namespace Metasound
 		const int32 NumSamples = AudioInput->Num();
 
 		OnePoleFIRDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, CoefA, CoefB, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+		if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("OnePoleFIR")))
+		{
+			OnePoleFIRDSPProcessor.Reset();
+		}
+#endif
+	}
+
+	void FOnePoleFIROperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		OnePoleFIRDSPProcessor.Reset();
 	}
 
 	METASOUND_REGISTER_NODE(FOnePoleFIRNode)
@@ -0,0 +1,178 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundOnePoleIIRBankNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_OnePoleIIRBankNode"
+
+namespace Metasound
+{
+
+	namespace OnePoleIIRBankNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput0, "In 0", "Audio input for lane 0.");
+		METASOUND_PARAM(InParamNameAudioInput1, "In 1", "Audio input for lane 1.");
+		METASOUND_PARAM(InParamNameAudioInput2, "In 2", "Audio input for lane 2.");
+		METASOUND_PARAM(InParamNameAudioInput3, "In 3", "Audio input for lane 3.");
+		METASOUND_PARAM(InParamNameAudioInput4, "In 4", "Audio input for lane 4.");
+		METASOUND_PARAM(InParamNameAudioInput5, "In 5", "Audio input for lane 5.");
+		METASOUND_PARAM(InParamNameAudioInput6, "In 6", "Audio input for lane 6.");
+		METASOUND_PARAM(InParamNameAudioInput7, "In 7", "Audio input for lane 7.");
+		METASOUND_PARAM(InParamNameCoefficientA, "CoefA", "Multiplier for IIR feedback path, shared by every lane.");
+		METASOUND_PARAM(InParamNameCoefficientB, "CoefB", "Multiplier for IIR current input sample, shared by every lane.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameAudio0, "Out 0", "Filtered lane 0.");
+		METASOUND_PARAM(OutParamNameAudio1, "Out 1", "Filtered lane 1.");
+		METASOUND_PARAM(OutParamNameAudio2, "Out 2", "Filtered lane 2.");
+		METASOUND_PARAM(OutParamNameAudio3, "Out 3", "Filtered lane 3.");
+		METASOUND_PARAM(OutParamNameAudio4, "Out 4", "Filtered lane 4.");
+		METASOUND_PARAM(OutParamNameAudio5, "Out 5", "Filtered lane 5.");
+		METASOUND_PARAM(OutParamNameAudio6, "Out 6", "Filtered lane 6.");
+		METASOUND_PARAM(OutParamNameAudio7, "Out 7", "Filtered lane 7.");
+
+		const FVertexName& GetInputName(const int32 InLane)
+		{
+			static const FVertexName Names[] = { METASOUND_GET_PARAM_NAME(InParamNameAudioInput0), METASOUND_GET_PARAM_NAME(InParamNameAudioInput1), METASOUND_GET_PARAM_NAME(InParamNameAudioInput2), METASOUND_GET_PARAM_NAME(InParamNameAudioInput3), METASOUND_GET_PARAM_NAME(InParamNameAudioInput4), METASOUND_GET_PARAM_NAME(InParamNameAudioInput5), METASOUND_GET_PARAM_NAME(InParamNameAudioInput6), METASOUND_GET_PARAM_NAME(InParamNameAudioInput7) };
+			return Names[InLane];
+		}
+
+		const FVertexName& GetOutputName(const int32 InLane)
+		{
+			static const FVertexName Names[] = { METASOUND_GET_PARAM_NAME(OutParamNameAudio0), METASOUND_GET_PARAM_NAME(OutParamNameAudio1), METASOUND_GET_PARAM_NAME(OutParamNameAudio2), METASOUND_GET_PARAM_NAME(OutParamNameAudio3), METASOUND_GET_PARAM_NAME(OutParamNameAudio4), METASOUND_GET_PARAM_NAME(OutParamNameAudio5), METASOUND_GET_PARAM_NAME(OutParamNameAudio6), METASOUND_GET_PARAM_NAME(OutParamNameAudio7) };
+			return Names[InLane];
+		}
+	} // namespace OnePoleIIRBankNode
+
+	FOnePoleIIRBankOperator::FOnePoleIIRBankOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FFloatReadRef& InCoefficientA, const FFloatReadRef& InCoefficientB)
+		: AudioInputs(InAudioInputs)
+		, mCoefficientA(InCoefficientA)
+		, mCoefficientB(InCoefficientB)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			AudioOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+			mInputData[Lane] = AudioInputs[Lane]->GetData();
+			mOutputData[Lane] = AudioOutputs[Lane]->GetData();
+		}
+	}
+
+	void FOnePoleIIRBankOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace OnePoleIIRBankNode;
+
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			InOutVertexData.BindReadVertex(GetInputName(Lane), AudioInputs[Lane]);
+			mInputData[Lane] = AudioInputs[Lane]->GetData();
+		}
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameCoefficientA), mCoefficientA);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameCoefficientB), mCoefficientB);
+	}
+
+	void FOnePoleIIRBankOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace OnePoleIIRBankNode;
+
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			InOutVertexData.BindReadVertex(GetOutputName(Lane), AudioOutputs[Lane]);
+		}
+	}
+
+	void FOnePoleIIRBankOperator::Execute()
+	{
+		mBank.SetCoefficients(*mCoefficientA, *mCoefficientB);
+		mBank.ProcessAudioBuffers(mInputData, mOutputData, AudioOutputs[0]->Num());
+	}
+
+	void FOnePoleIIRBankOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			AudioOutputs[Lane]->Zero();
+		}
+
+		mBank.Reset();
+	}
+
+	TUniquePtr<IOperator> FOnePoleIIRBankOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace OnePoleIIRBankNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		TArray<FAudioBufferReadRef> AudioIns;
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			AudioIns.Add(InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(GetInputName(Lane), InParams.OperatorSettings));
+		}
+
+		FFloatReadRef InCoefficientA = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameCoefficientA), InParams.OperatorSettings);
+		FFloatReadRef InCoefficientB = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameCoefficientB), InParams.OperatorSettings);
+
+		return MakeUnique<FOnePoleIIRBankOperator>(InParams.OperatorSettings, AudioIns, InCoefficientA, InCoefficientB);
+	}
+
+	const FVertexInterface& FOnePoleIIRBankOperator::GetVertexInterface()
+	{
+		using namespace OnePoleIIRBankNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput0)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput1)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput2)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput3)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput4)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput5)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput6)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput7)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameCoefficientA), 0.99f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameCoefficientB), 0.01f)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio0)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio1)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio2)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio3)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio4)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio5)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio6)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio7))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FOnePoleIIRBankOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("OnePoleIIR Bank"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_OnePoleIIRBankDisplayName", "OnePoleIIR Bank");
+				Info.Description = LOCTEXT("Metasound_OnePoleIIRBankNodeDescription", "Applies yn = b*xn + a*yn-1 to eight inputs at once, e.g. to smooth a voice's parameters with one node instead of eight. Unused lanes cost almost nothing.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_OnePoleIIRBankNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FOnePoleIIRBankNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -27,7 +27,7 @@ namespace Metasound
 		, mCoefficientB(InCoefficientB)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
 	{
-
+		OnePoleIIRDSPProcessor.SetBlockSize(InSettings.GetNumFramesPerBlock());
 	}
 
 	const FNodeClassMetadata& FOnePoleIIROperator::GetNodeInfo()
@@ -113,6 +113,19 @@ namespace Metasound
 		const int32 NumSamples = AudioInput->Num();
 
 		OnePoleIIRDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, CoefA, CoefB, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+		if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("OnePoleIIR")))
+		{
+			OnePoleIIRDSPProcessor.Reset();
+		}
+#endif
+	}
+
+	void FOnePoleIIROperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		OnePoleIIRDSPProcessor.Reset();
 	}
 
 	METASOUND_REGISTER_NODE(FOnePoleIIRNode)
@@ -12,23 +12,17 @@ namespace Metasound
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
 			METASOUND_PARAM(InParamNamePowerOf, "Pow", "The value to test the input against")
+			METASOUND_PARAM(InParamNameAntiAliasing, "Anti-Aliasing", "How the aliasing this nonlinearity generates is suppressed. Oversampling adds latency, see the Latency output.")
 
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+			METASOUND_PARAM(OutParamNameLatency, "Latency", "Delay added by the anti-aliasing mode.")
 	}
 
 	//------------------------------------------------------------------------------------
 	// FPowOperator
 	//------------------------------------------------------------------------------------
-	FPowOperator::FPowOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPowerOf)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-		, mInPowerOf(InPowerOf)
-	{
-
-	}
-
-	const FNodeClassMetadata& FPowOperator::GetNodeInfo()
+	const FNodeClassMetadata& FPowNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -36,7 +30,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Pow (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 1;
 				Info.DisplayName = LOCTEXT("Metasound_PowDisplayName", "Pow (Audio)");
 				Info.Description = LOCTEXT("Metasound_PowNodeDescription", "Returns input 1 to the power of input 2");
 				Info.Author = "Chris Wratt";
@@ -52,65 +46,64 @@ namespace Metasound
 		return Info;
 	}
 
-	void FPowOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace PowNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNamePowerOf), mInPowerOf);
-	}
-
-	void FPowOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace PowNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FPowOperator::GetVertexInterface()
+	const FVertexInterface& FPowNodeOp::GetVertexInterface()
 	{
 		using namespace PowNode;
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePowerOf))
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePowerOf)),
+				TInputDataVertex<FEnumAntiAliasing>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAntiAliasing), (int32)DSPProcessing::EAntiAliasing::None)
 			),
 
 			FOutputVertexInterface(
-				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio)),
+				TOutputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameLatency))
 			)
 		);
 
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FPowOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FPowNodeOp::GetInputName()
 	{
 		using namespace PowNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
+	}
 
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
-		FAudioBufferReadRef InPowerOf = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNamePowerOf), InParams.OperatorSettings);
+	FVertexName FPowNodeOp::GetOperandName()
+	{
+		using namespace PowNode;
 
+		return METASOUND_GET_PARAM_NAME(InParamNamePowerOf);
+	}
 
-		return MakeUnique<FPowOperator>(InParams.OperatorSettings, AudioIn, InPowerOf);
+	FVertexName FPowNodeOp::GetOutputName()
+	{
+		using namespace PowNode;
+
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
-	void FPowOperator::Execute()
+	FVertexName FPowNodeOp::GetAntiAliasingName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
-		const float* InputPowerOf = mInPowerOf->GetData();
+		using namespace PowNode;
+
+		return METASOUND_GET_PARAM_NAME(InParamNameAntiAliasing);
+	}
 
-		const int32 NumSamples = AudioInput->Num();
+	FVertexName FPowNodeOp::GetLatencyName()
+	{
+		using namespace PowNode;
 
-		PowDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputPowerOf, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameLatency);
 	}
 
 	METASOUND_REGISTER_NODE(FPowNode)
+	METASOUND_REGISTER_NODE(FPowStereoNode)
+	METASOUND_REGISTER_NODE(FPowQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,144 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundProbeNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_ProbeNode"
+
+namespace Metasound
+{
+
+	namespace ProbeNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input to inspect.");
+		METASOUND_PARAM(InParamNameChannel, "Channel", "If set, each block summary is published to the lock-free event channel of this name. Read it with FAudioMathEventChannels::FindOrAddProbeChannel. Fixed when the graph is built.");
+		METASOUND_PARAM(InParamNameDecimation, "Decimation", "Samples per waveform point, 0 sends no waveform. Raised as needed to fit the block into 64 points.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameAudio, "Out", "The input, unchanged.");
+	} // namespace ProbeNode
+
+	FProbeOperator::FProbeOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FString& InChannelName, const FInt32ReadRef& InDecimation)
+		: AudioInput(InAudioInput)
+		, mDecimation(InDecimation)
+		, SampleRate(InSettings.GetSampleRate())
+		, mBlockStartSample(0)
+	{
+		if (!InChannelName.IsEmpty())
+		{
+			mEventWriter = FAudioMathEventChannels::ClaimProbeWriter(FName(*InChannelName));
+		}
+	}
+
+	void FProbeOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace ProbeNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameDecimation), mDecimation);
+	}
+
+	void FProbeOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace ProbeNode;
+
+		// the output shares the input's buffer, so inserting a probe costs no copy
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioInput);
+	}
+
+	void FProbeOperator::Execute()
+	{
+		const int32 NumSamples = AudioInput->Num();
+
+		if (mEventWriter.IsValid())
+		{
+			const float* InputAudio = AudioInput->GetData();
+
+			FProbeBlockSummary Summary;
+			Summary.BlockStartSample = mBlockStartSample;
+			Summary.NumSamples = NumSamples;
+			Summary.SampleRate = SampleRate;
+
+			const DSPProcessing::FBlockStats Stats = DSPProcessing::ComputeBlockStats(InputAudio, NumSamples);
+			Summary.Min = Stats.Min;
+			Summary.Max = Stats.Max;
+			Summary.Peak = FMath::Max(FMath::Abs(Stats.Min), FMath::Abs(Stats.Max));
+			Summary.Rms = NumSamples > 0 ? FMath::Sqrt(Stats.SumOfSquares / NumSamples) : 0.0f;
+
+			if (*mDecimation > 0)
+			{
+				const int32 MinStride = (NumSamples + FProbeBlockSummary::MaxWaveformPoints - 1) / FProbeBlockSummary::MaxWaveformPoints;
+				const int32 Stride = FMath::Max(*mDecimation, MinStride);
+				Summary.NumWaveformPoints = DSPProcessing::DecimatePeaks(InputAudio, NumSamples, Stride, Summary.Waveform);
+			}
+
+			mEventWriter.Push(Summary);
+		}
+
+		mBlockStartSample += NumSamples;
+	}
+
+	void FProbeOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		mBlockStartSample = 0;
+	}
+
+	TUniquePtr<IOperator> FProbeOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace ProbeNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FStringReadRef InChannel = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameChannel), InParams.OperatorSettings);
+		FInt32ReadRef InDecimation = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameDecimation), InParams.OperatorSettings);
+
+		return MakeUnique<FProbeOperator>(InParams.OperatorSettings, AudioIn, *InChannel, InDecimation);
+	}
+
+	const FVertexInterface& FProbeOperator::GetVertexInterface()
+	{
+		using namespace ProbeNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputConstructorVertex<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameChannel), FString()),
+				TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameDecimation), 0)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FProbeOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Probe (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_ProbeDisplayName", "Probe (Audio)");
+				Info.Description = LOCTEXT("Metasound_ProbeNodeDescription", "Passes audio through and publishes each block's peak, RMS, min/max and an optional decimated waveform to a lock-free channel for debug tools to read.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_ProbeNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FProbeNode)
+}
+
+#undef LOCTEXT_NAMESPACE
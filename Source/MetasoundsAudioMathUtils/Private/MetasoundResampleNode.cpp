@@ -0,0 +1,168 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundResampleNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_ResampleNode"
+
+namespace Metasound
+{
+
+	namespace ResampleNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.");
+		METASOUND_PARAM(InParamNameRatio, "Ratio", "Input samples read per output sample: 1 plays through, 0.5 an octave down, 0 freezes.");
+		METASOUND_PARAM(InParamNameRatioMod, "Ratio Mod", "Audio rate offset added to Ratio, for vibrato or Doppler.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameAudio, "Out", "Resampled audio output.");
+	} // namespace ResampleNode
+
+	FResampleOperator::FResampleOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FFloatReadRef& InRatio, const FAudioBufferReadRef& InRatioMod)
+		: AudioInput(InAudioInput)
+		, mRatio(InRatio)
+		, mRatioMod(InRatioMod)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mTableDesigner([](DSPProcessing::FPolyphaseFilterTable& OutTable, const float& InCutoff)
+			{
+				OutTable.Design(InCutoff);
+			})
+	{
+		mModulatedRatio.SetNumZeroed(InSettings.GetNumFramesPerBlock());
+
+		// the operator is built off the audio thread, so the first table can be designed in place
+		mRequestedCutoff = DSPProcessing::FPolyphaseResampler::GetCutoffForRatio(*mRatio);
+		mResampler.SetCutoff(mRequestedCutoff);
+	}
+
+	void FResampleOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace ResampleNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameRatio), mRatio);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameRatioMod), mRatioMod);
+	}
+
+	void FResampleOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace ResampleNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	void FResampleOperator::UpdateCutoff(const float InMaxRatio)
+	{
+		// A new table is requested when the band limit the block's fastest ratio needs moves by more than 5%. It is
+		// designed on the design worker and the resampler reads through the previous one until it arrives, usually a block or
+		// two later.
+		const float Cutoff = DSPProcessing::FPolyphaseResampler::GetCutoffForRatio(InMaxRatio);
+		if (FMath::Abs(Cutoff - mRequestedCutoff) > 0.05f * mRequestedCutoff)
+		{
+			mRequestedCutoff = Cutoff;
+			mTableDesigner.RequestDesign([Cutoff](float& OutCutoff)
+				{
+					OutCutoff = Cutoff;
+				});
+		}
+
+		if (mTableDesigner.Update())
+		{
+			mResampler.SetFilterTable(mTableDesigner.GetCurrent());
+		}
+	}
+
+	void FResampleOperator::Execute()
+	{
+		const float* InputAudio = AudioInput->GetData();
+		const float* RatioMod = mRatioMod->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+		const int32 NumSamples = AudioInput->Num();
+
+		if (DSPProcessing::IsBufferSilent(RatioMod, NumSamples))
+		{
+			UpdateCutoff(*mRatio);
+			mResampler.ProcessAudioBuffer(InputAudio, OutputAudio, *mRatio, NumSamples);
+			return;
+		}
+
+		float* ModulatedRatio = mModulatedRatio.GetData();
+		const float Ratio = *mRatio;
+		float MaxRatio = Ratio + RatioMod[0];
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			ModulatedRatio[Index] = Ratio + RatioMod[Index];
+			MaxRatio = FMath::Max(MaxRatio, ModulatedRatio[Index]);
+		}
+
+		// band limit for the fastest read in the block, or modulation above Ratio would alias
+		UpdateCutoff(MaxRatio);
+
+		mResampler.ProcessAudioBuffer(InputAudio, OutputAudio, ModulatedRatio, NumSamples);
+	}
+
+	void FResampleOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		mResampler.Reset();
+		UpdateCutoff(*mRatio);
+	}
+
+	TUniquePtr<IOperator> FResampleOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace ResampleNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FFloatReadRef InRatio = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameRatio), InParams.OperatorSettings);
+		FAudioBufferReadRef InRatioMod = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameRatioMod), InParams.OperatorSettings);
+
+		return MakeUnique<FResampleOperator>(InParams.OperatorSettings, AudioIn, InRatio, InRatioMod);
+	}
+
+	const FVertexInterface& FResampleOperator::GetVertexInterface()
+	{
+		using namespace ResampleNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameRatio), 1.0f),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameRatioMod))
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FResampleOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Resample (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_ResampleDisplayName", "Resample (Audio)");
+				Info.Description = LOCTEXT("Metasound_ResampleNodeDescription", "Reads the input at an arbitrary, modulatable ratio with band limited polyphase interpolation (varispeed, Doppler, tape stop). Buffers about 1.4 seconds; above ratio 1 the read position holds at the newest input once it catches up.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_ResampleNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FResampleNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,143 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundSampholdNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_SampholdNode"
+
+namespace Metasound
+{
+	DEFINE_METASOUND_ENUM_BEGIN(ESampholdMode, FEnumSampholdMode, "SampholdMode")
+		DEFINE_METASOUND_ENUM_ENTRY(ESampholdMode::Phasor, "PhasorDescription", "Phasor", "PhasorDescriptionTT", "Samples the input each time the Phasor input wraps, like Pd's samphold~."),
+		DEFINE_METASOUND_ENUM_ENTRY(ESampholdMode::Trigger, "TriggerDescription", "Trigger", "TriggerDescriptionTT", "Samples the input on each trigger."),
+		DEFINE_METASOUND_ENUM_END()
+
+	namespace SampholdNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio to sample.");
+		METASOUND_PARAM(InParamNamePhasor, "Phasor", "The input is sampled whenever this drops below its previous value (Phasor mode).");
+		METASOUND_PARAM(InParamNameTrigger, "Trigger", "The input is sampled at each trigger (Trigger mode).");
+		METASOUND_PARAM(InParamNameMode, "Mode", "Whether the Phasor or Trigger input decides when to sample.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameAudio, "Out", "The last sampled value.");
+	} // namespace SampholdNode
+
+	FSampholdOperator::FSampholdOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPhasor, const FTriggerReadRef& InTrigger, const FEnumSampholdModeReadRef& InMode)
+		: AudioInput(InAudioInput)
+		, mPhasor(InPhasor)
+		, TriggerIn(InTrigger)
+		, mMode(InMode)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+	{
+	}
+
+	void FSampholdOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace SampholdNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNamePhasor), mPhasor);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameTrigger), TriggerIn);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameMode), mMode);
+	}
+
+	void FSampholdOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace SampholdNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	void FSampholdOperator::Execute()
+	{
+		const float* InputAudio = AudioInput->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+		const int32 NumSamples = AudioInput->Num();
+
+		if (*mMode == ESampholdMode::Phasor)
+		{
+			mSamphold.ProcessAudioBuffer(InputAudio, OutputAudio, mPhasor->GetData(), NumSamples);
+			return;
+		}
+
+		// only the trigger frames read the input, everything between them is a bulk fill
+		TriggerIn->ExecuteBlock(
+			[this, OutputAudio](int32 StartFrame, int32 EndFrame)
+			{
+				mSamphold.Hold(OutputAudio, StartFrame, EndFrame);
+			},
+			[this, InputAudio, OutputAudio](int32 StartFrame, int32 EndFrame)
+			{
+				mSamphold.SampleAndHold(InputAudio, OutputAudio, StartFrame, EndFrame);
+			}
+		);
+	}
+
+	void FSampholdOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		mSamphold.Reset();
+	}
+
+	TUniquePtr<IOperator> FSampholdOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace SampholdNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FAudioBufferReadRef PhasorIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNamePhasor), InParams.OperatorSettings);
+		FTriggerReadRef TriggerIn = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InParamNameTrigger), InParams.OperatorSettings);
+		FEnumSampholdModeReadRef InMode = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumSampholdMode>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameMode), InParams.OperatorSettings);
+
+		return MakeUnique<FSampholdOperator>(InParams.OperatorSettings, AudioIn, PhasorIn, TriggerIn, InMode);
+	}
+
+	const FVertexInterface& FSampholdOperator::GetVertexInterface()
+	{
+		using namespace SampholdNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePhasor)),
+				TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameTrigger)),
+				TInputDataVertex<FEnumSampholdMode>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameMode), (int32)ESampholdMode::Phasor)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FSampholdOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Samphold (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_SampholdDisplayName", "Samphold (Audio)");
+				Info.Description = LOCTEXT("Metasound_SampholdNodeDescription", "Sample and hold: outputs the input as it was at the last phasor wrap or trigger.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_SampholdNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FSampholdNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -18,14 +18,7 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FSineOperator
 	//------------------------------------------------------------------------------------
-	FSineOperator::FSineOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-	{
-
-	}
-
-	const FNodeClassMetadata& FSineOperator::GetNodeInfo()
+	const FNodeClassMetadata& FSineNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -49,21 +42,7 @@ namespace Metasound
 		return Info;
 	}
 
-	void FSineOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace SineNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-	}
-
-	void FSineOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace SineNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FSineOperator::GetVertexInterface()
+	const FVertexInterface& FSineNodeOp::GetVertexInterface()
 	{
 		using namespace SineNode;
 
@@ -79,29 +58,23 @@ namespace Metasound
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FSineOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FSineNodeOp::GetInputName()
 	{
 		using namespace SineNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
-
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
-
-		return MakeUnique<FSineOperator>(InParams.OperatorSettings, AudioIn);
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
 	}
 
-	void FSineOperator::Execute()
+	FVertexName FSineNodeOp::GetOutputName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
-
-		const int32 NumSamples = AudioInput->Num();
+		using namespace SineNode;
 
-		SineDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
 	METASOUND_REGISTER_NODE(FSineNode)
+	METASOUND_REGISTER_NODE(FSineStereoNode)
+	METASOUND_REGISTER_NODE(FSineQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,118 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundSineOscNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_SineOscNode"
+
+namespace Metasound
+{
+	namespace SineOscNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameFrequency, "Frequency", "Frequency in Hz, read every sample.");
+		METASOUND_PARAM(InParamNamePhaseMod, "Phase Mod", "Added to the phase in cycles, so 1 is a whole period.");
+
+		// Output params
+		METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.");
+	} // namespace SineOscNode
+
+	FSineOscOperator::FSineOscOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InFrequency, const FAudioBufferReadRef& InPhaseMod)
+		: mFrequency(InFrequency)
+		, mPhaseMod(InPhaseMod)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+	{
+		mOscillator.Init(InSettings.GetSampleRate());
+	}
+
+	void FSineOscOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace SineOscNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameFrequency), mFrequency);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNamePhaseMod), mPhaseMod);
+	}
+
+	void FSineOscOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace SineOscNode;
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	void FSineOscOperator::Execute()
+	{
+		float* OutputAudio = AudioOutput->GetData();
+		const int32 NumSamples = AudioOutput->Num();
+
+		mOscillator.ProcessAudioBuffer(mFrequency->GetData(), mPhaseMod->GetData(), OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+		// a non-finite frequency would otherwise leave the phase stuck at NaN
+		if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("Sine Osc (Audio)")))
+		{
+			mOscillator.Reset();
+		}
+#endif
+	}
+
+	void FSineOscOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		mOscillator.Reset();
+	}
+
+	TUniquePtr<IOperator> FSineOscOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace SineOscNode;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+		FAudioBufferReadRef FrequencyIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameFrequency), InParams.OperatorSettings);
+		FAudioBufferReadRef PhaseModIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNamePhaseMod), InParams.OperatorSettings);
+
+		return MakeUnique<FSineOscOperator>(InParams.OperatorSettings, FrequencyIn, PhaseModIn);
+	}
+
+	const FVertexInterface& FSineOscOperator::GetVertexInterface()
+	{
+		using namespace SineOscNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameFrequency)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePhaseMod))
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	const FNodeClassMetadata& FSineOscOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Sine Osc (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_SineOscDisplayName", "Sine Osc (Audio)");
+				Info.Description = LOCTEXT("Metasound_SineOscNodeDescription", "Sine oscillator with audio rate frequency and phase modulation. Does the work of a phasor into Sine (Audio) in one pass, with a double precision phase that does not drift.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_SineOscNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+		return Info;
+	}
+
+	METASOUND_REGISTER_NODE(FSineOscNode)
+}
+
+#undef LOCTEXT_NAMESPACE
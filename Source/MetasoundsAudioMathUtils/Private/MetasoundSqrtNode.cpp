@@ -11,21 +11,17 @@ namespace Metasound
 	{
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
+			METASOUND_PARAM(InParamNameAntiAliasing, "Anti-Aliasing", "How the aliasing this nonlinearity generates is suppressed. Oversampling adds latency, see the Latency output.")
+
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+			METASOUND_PARAM(OutParamNameLatency, "Latency", "Delay added by the anti-aliasing mode.")
 	}
 
 	//------------------------------------------------------------------------------------
 	// FSqrtOperator
 	//------------------------------------------------------------------------------------
-	FSqrtOperator::FSqrtOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-	{
-
-	}
-
-	const FNodeClassMetadata& FSqrtOperator::GetNodeInfo()
+	const FNodeClassMetadata& FSqrtNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -33,7 +29,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Sqrt"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 1;
 				Info.DisplayName = LOCTEXT("Metasound_SqrtDisplayName", "Sqrt (Audio)");
 				Info.Description = LOCTEXT("Metasound_SqrtNodeDescription", "Applies Sqrt to the audio input.");
 				Info.Author = PluginAuthor;
@@ -49,59 +45,55 @@ namespace Metasound
 		return Info;
 	}
 
-	void FSqrtOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace SqrtNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-	}
-
-	void FSqrtOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace SqrtNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FSqrtOperator::GetVertexInterface()
+	const FVertexInterface& FSqrtNodeOp::GetVertexInterface()
 	{
 		using namespace SqrtNode;
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FEnumAntiAliasing>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAntiAliasing), (int32)DSPProcessing::EAntiAliasing::None)),
 
 			FOutputVertexInterface(
-				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio)),
+				TOutputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameLatency))
 			)
 		);
 
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FSqrtOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FSqrtNodeOp::GetInputName()
 	{
 		using namespace SqrtNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
+	}
 
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+	FVertexName FSqrtNodeOp::GetOutputName()
+	{
+		using namespace SqrtNode;
 
-		return MakeUnique<FSqrtOperator>(InParams.OperatorSettings, AudioIn);
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
-	void FSqrtOperator::Execute()
+	FVertexName FSqrtNodeOp::GetAntiAliasingName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
+		using namespace SqrtNode;
+
+		return METASOUND_GET_PARAM_NAME(InParamNameAntiAliasing);
+	}
 
-		const int32 NumSamples = AudioInput->Num();
+	FVertexName FSqrtNodeOp::GetLatencyName()
+	{
+		using namespace SqrtNode;
 
-		SqrtDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameLatency);
 	}
 
 	METASOUND_REGISTER_NODE(FSqrtNode)
+	METASOUND_REGISTER_NODE(FSqrtStereoNode)
+	METASOUND_REGISTER_NODE(FSqrtQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
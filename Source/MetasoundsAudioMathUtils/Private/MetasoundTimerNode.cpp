@@ -11,14 +11,27 @@ namespace Metasound
 namespace TimerNode
 {
 METASOUND_PARAM(InputInTimerNode, "In", "Input trigger which outputs time since last trigger.");
+METASOUND_PARAM(InputChannelName, "Channel", "If set, every interval is also published to the lock-free event channel of this name for gameplay code to read. Fixed when the graph is built.");
 METASOUND_PARAM(OutputTimeOnTrigger, "Out", "The time between triggers.");
+METASOUND_PARAM(OutputIntervals, "Intervals", "Every interval that ended in this block, in trigger order.");
 } // namespace TimerNodeVertexNames
 
-FTimerNodeOperator::FTimerNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn)
+FTimerNodeOperator::FTimerNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn, const FString& InChannelName)
 	: SampleRate(InSettings.GetSampleRate())
+	, BlockSize(InSettings.GetNumFramesPerBlock())
 	, TriggerIn(InTriggerIn)
 	, mTimeSeconds(TDataWriteReferenceFactory<FTime>::CreateExplicitArgs(InParams.OperatorSettings))
+	, mIntervals(TDataWriteReference<TArray<FTime>>::CreateNew())
+	, mSampsSinceLastTrigger(0)
+	, mBlockStartSample(0)
 {
+	// at most one trigger per frame, reserve for all of them so Execute never allocates
+	mIntervals->Reserve(BlockSize);
+
+	if (!InChannelName.IsEmpty())
+	{
+		mEventWriter = FAudioMathEventChannels::ClaimTimerWriter(FName(*InChannelName));
+	}
 }
 
 void FTimerNodeOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
@@ -31,6 +44,7 @@ void FTimerNodeOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData
 {
 	using namespace TimerNode;
 	InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputTimeOnTrigger), mTimeSeconds);
+	InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputIntervals), mIntervals);
 }
 
 FDataReferenceCollection FTimerNodeOperator::GetInputs() const
@@ -51,7 +65,7 @@ FDataReferenceCollection FTimerNodeOperator::GetOutputs() const
 
 void FTimerNodeOperator::Execute()
 {
-
+	mIntervals->Reset();
 
 	TriggerIn->ExecuteBlock(
 		[&](int32 StartFrame, int32 EndFrame)
@@ -60,13 +74,33 @@ void FTimerNodeOperator::Execute()
 		},
 		[this](int32 StartFrame, int32 EndFrame)
 		{
-			float NewTimeSeconds = ((float)mSampsSinceLastTrigger + (float)StartFrame) / (float)SampleRate;
-			*mTimeSeconds = FTime(NewTimeSeconds);
-
-			mSampsSinceLastTrigger = 0;
-			mSampsSinceLastTrigger += EndFrame - StartFrame;
+			// frames up to this trigger were already counted by the previous span
+			const int64 IntervalSamples = mSampsSinceLastTrigger;
+			*mTimeSeconds = FTime((double)IntervalSamples / SampleRate);
+			mIntervals->Add(*mTimeSeconds);
+
+			if (mEventWriter.IsValid())
+			{
+				FTimerIntervalEvent Event;
+				Event.TriggerSample = mBlockStartSample + StartFrame;
+				Event.IntervalSamples = IntervalSamples;
+				Event.SampleRate = SampleRate;
+				mEventWriter.Push(Event);
+			}
+
+			mSampsSinceLastTrigger = EndFrame - StartFrame;
 		}
 	);
+
+	mBlockStartSample += BlockSize;
+}
+
+void FTimerNodeOperator::Reset(const IOperator::FResetParams& InParams)
+{
+	*mTimeSeconds = FTime(0.0f);
+	mIntervals->Reset();
+	mSampsSinceLastTrigger = 0;
+	mBlockStartSample = 0;
 }
 
 TUniquePtr<IOperator> FTimerNodeOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -75,9 +109,12 @@ TUniquePtr<IOperator> FTimerNodeOperator::CreateOperator(const FBuildOperatorPar
 
 	const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
 
-	FTriggerReadRef TriggerIn = InParams.InputData.ToDataReferenceCollection().GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InputInTimerNode), InParams.OperatorSettings);
+	const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+	FTriggerReadRef TriggerIn = InputCollection.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InputInTimerNode), InParams.OperatorSettings);
+	FStringReadRef ChannelName = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FString>(InputInterface, METASOUND_GET_PARAM_NAME(InputChannelName), InParams.OperatorSettings);
 
-	return MakeUnique<FTimerNodeOperator>(InParams.OperatorSettings, InParams, TriggerIn);
+	return MakeUnique<FTimerNodeOperator>(InParams.OperatorSettings, InParams, TriggerIn, *ChannelName);
 }
 
 const FVertexInterface& FTimerNodeOperator::GetVertexInterface()
@@ -86,10 +123,12 @@ const FVertexInterface& FTimerNodeOperator::GetVertexInterface()
 
 	static const FVertexInterface Interface(
 		FInputVertexInterface(
-			TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInTimerNode))
+			TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInTimerNode)),
+			TInputConstructorVertex<FString>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputChannelName), FString())
 		),
 		FOutputVertexInterface(
-			TOutputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputTimeOnTrigger))
+			TOutputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputTimeOnTrigger)),
+			TOutputDataVertex<TArray<FTime>>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputIntervals))
 		)
 	);
 
@@ -104,9 +143,9 @@ const FNodeClassMetadata& FTimerNodeOperator::GetNodeInfo()
 
 			Info.ClassName = { TEXT("UE"), TEXT("Timer"), TEXT("") };
 			Info.MajorVersion = 1;
-			Info.MinorVersion = 0;
+			Info.MinorVersion = 1;
 			Info.DisplayName = LOCTEXT("Metasound_TimerNodeDisplayName", "Timer");
-			Info.Description = LOCTEXT("Metasound_TimerNodeDescription", "Outputs time between triggers (does not support multiple triggers in single buffer callback)");
+			Info.Description = LOCTEXT("Metasound_TimerNodeDescription", "Outputs time between triggers, sample accurate for any number of triggers per block");
 			Info.Author = "Chris Wratt";
 			Info.PromptIfMissing = PluginNodeMissingPrompt;
 			Info.DefaultInterface = GetVertexInterface();
@@ -2,6 +2,7 @@
 // All code under MIT license: see https://mit-license.org/
 
 #include "MetasoundVCFNode.h"
+#include "AudioUtils.h"
 
 #define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_VCFNode"
 
@@ -10,7 +11,7 @@ namespace Metasound
 	DEFINE_METASOUND_ENUM_BEGIN(EVCFFilterType, FEnumVCFFilterType, "VCFFilterType")
 		DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::LowPass, "LowPassDescription", "LowPass", "LowPassDescriptionTT", ""),
 		DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::BandPass, "BandPassDescriptioin", "BandPass", "BandPassDescriptioinTT", ""),
-		//DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::HighPass, "HighPassDescription", "HighPass", "HighPassDescriptionTT", ""),
+		DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::HighPass, "HighPassDescription", "HighPass", "HighPassDescriptionTT", ""),
 		DEFINE_METASOUND_ENUM_END()
 
 	namespace VCFNode
@@ -23,6 +24,24 @@ namespace Metasound
 
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+
+		void SetFilterType(DSPProcessing::CytomicSVF& InOutFilter, const EVCFFilterType InFilterType)
+		{
+			switch (InFilterType)
+			{
+			case EVCFFilterType::LowPass:
+				InOutFilter.SetLPF();
+				break;
+
+			case EVCFFilterType::BandPass:
+				InOutFilter.setBP();
+				break;
+
+			case EVCFFilterType::HighPass:
+				InOutFilter.setHPF();
+				break;
+			}
+		}
 	}
 
 	//------------------------------------------------------------------------------------
@@ -35,6 +54,7 @@ namespace Metasound
 		, mInVCFQ(InVCFQ)
 		, mFilterType(filterType)
 	{
+		mCytomicSVF.SetBlockSize(InSettings.GetNumFramesPerBlock());
 		Init();
 	}
 
@@ -48,7 +68,7 @@ namespace Metasound
 				Info.MajorVersion = 1;
 				Info.MinorVersion = 0;
 				Info.DisplayName = LOCTEXT("Metasound_VCFDisplayName", "VCF (Audio)");
-				Info.Description = LOCTEXT("Metasound_VCFNodeDescription", "Filter that can modulate up to nyquist: 2 pole, 12dB / 8ve. From http://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf, not high pass is currently bugged!");
+				Info.Description = LOCTEXT("Metasound_VCFNodeDescription", "Filter that can modulate up to nyquist: 2 pole, 12dB / 8ve. From http://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf");
 				Info.Author = "Chris Wratt";
 				Info.PromptIfMissing = PluginNodeMissingPrompt;
 				Info.DefaultInterface = GetVertexInterface();
@@ -125,28 +145,174 @@ namespace Metasound
 		const int32 NumSamples = AudioInput->Num();
 
 		mCytomicSVF.ProcessAudioBuffer(InputAudio, OutputAudio, InputVCFCutoff, InputVCFQ, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+		if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("VCF (Audio)")))
+		{
+			mCytomicSVF.Reset();
+		}
+#endif
+	}
+
+	void FVCFOperator::Reset(const IOperator::FResetParams& InParams)
+	{
+		AudioOutput->Zero();
+		mCytomicSVF.Reset();
+
+		// the filter type may differ for the recycled voice
+		Init();
 	}
 
 	void FVCFOperator::Init()
 	{
 		// need to put a proper watcher on this rather than just calling all the time.
-		switch (*mFilterType)
+		VCFNode::SetFilterType(mCytomicSVF, *mFilterType);
+	}
+
+	//------------------------------------------------------------------------------------
+	// TMultichannelVCFOperator
+	//------------------------------------------------------------------------------------
+	template<int32 NumChannels>
+	TMultichannelVCFOperator<NumChannels>::TMultichannelVCFOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, const FEnumVCFFilterTypeReadRef& InFilterType)
+		: AudioInputs(InAudioInputs)
+		, mInVCFCutoff(InVCFCutoff)
+		, mInVCFQ(InVCFQ)
+		, mFilterType(InFilterType)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+			mCytomicSVFs[Channel].SetBlockSize(InSettings.GetNumFramesPerBlock());
+		}
+
+		Init();
+	}
+
+	template<int32 NumChannels>
+	const FNodeClassMetadata& TMultichannelVCFOperator<NumChannels>::GetNodeInfo()
+	{
+		static const FNodeClassMetadata Info = MultichannelAudioMath::MakeNodeInfo(FVCFOperator::GetNodeInfo(), NumChannels, GetVertexInterface());
+		return Info;
+	}
+
+	template<int32 NumChannels>
+	const FVertexInterface& TMultichannelVCFOperator<NumChannels>::GetVertexInterface()
+	{
+		using namespace VCFNode;
+
+		static const FVertexInterface Interface = MultichannelAudioMath::MakeVertexInterface(FVCFOperator::GetVertexInterface(), METASOUND_GET_PARAM_NAME(InParamNameAudioInput), METASOUND_GET_PARAM_NAME(OutParamNameAudio), NumChannels);
+		return Interface;
+	}
+
+	template<int32 NumChannels>
+	FVertexName TMultichannelVCFOperator<NumChannels>::GetInputName(const int32 InChannel)
+	{
+		using namespace VCFNode;
+
+		return MultichannelAudioMath::MakeChannelVertexName(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), NumChannels, InChannel);
+	}
+
+	template<int32 NumChannels>
+	FVertexName TMultichannelVCFOperator<NumChannels>::GetOutputName(const int32 InChannel)
+	{
+		using namespace VCFNode;
+
+		return MultichannelAudioMath::MakeChannelVertexName(METASOUND_GET_PARAM_NAME(OutParamNameAudio), NumChannels, InChannel);
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelVCFOperator<NumChannels>::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace VCFNode;
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			InOutVertexData.BindReadVertex(GetInputName(Channel), AudioInputs[Channel]);
+		}
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCFCutoff), mInVCFCutoff);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCFQ), mInVCFQ);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCOFilterType), mFilterType);
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelVCFOperator<NumChannels>::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			InOutVertexData.BindReadVertex(GetOutputName(Channel), AudioOutputs[Channel]);
+		}
+	}
+
+	template<int32 NumChannels>
+	TUniquePtr<IOperator> TMultichannelVCFOperator<NumChannels>::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace VCFNode;
+
+		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		TArray<FAudioBufferReadRef> AudioIns;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioIns.Add(InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(GetInputName(Channel), InParams.OperatorSettings));
+		}
+
+		FAudioBufferReadRef InVCFCutoff = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameVCFCutoff), InParams.OperatorSettings);
+		FAudioBufferReadRef InVCFQ = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameVCFQ), InParams.OperatorSettings);
+		FEnumVCFFilterTypeReadRef InFilterType = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumVCFFilterType>(InputInterface, METASOUND_GET_PARAM_NAME(InParamNameVCOFilterType), InParams.OperatorSettings);
+
+		return MakeUnique<TMultichannelVCFOperator<NumChannels>>(InParams.OperatorSettings, AudioIns, InVCFCutoff, InVCFQ, InFilterType);
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelVCFOperator<NumChannels>::Execute()
+	{
+		const float* InputVCFCutoff = mInVCFCutoff->GetData();
+		const float* InputVCFQ = mInVCFQ->GetData();
+		const int32 NumSamples = AudioInputs[0]->Num();
+
+		// Whole blocks per channel rather than chunks: the filter's loops are unrolled for the block size, and the
+		// shared cutoff and Q blocks are small enough to stay cached from one channel to the next.
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
 		{
-		case EVCFFilterType::LowPass:
-			mCytomicSVF.SetLPF();
-			break;
+			float* OutputAudio = AudioOutputs[Channel]->GetData();
+			mCytomicSVFs[Channel].ProcessAudioBuffer(AudioInputs[Channel]->GetData(), OutputAudio, InputVCFCutoff, InputVCFQ, NumSamples);
 
-		case EVCFFilterType::BandPass:
-			mCytomicSVF.setBP();
-			break;
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+			if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, TEXT("VCF (Audio)")))
+			{
+				mCytomicSVFs[Channel].Reset();
+			}
+#endif
+		}
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelVCFOperator<NumChannels>::Reset(const IOperator::FResetParams& InParams)
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioOutputs[Channel]->Zero();
+			mCytomicSVFs[Channel].Reset();
+		}
 
-		//case EVCFFilterType::HighPass:
-		//	mCytomicSVF.setHPF();
-		//	break;
+		// the filter type may differ for the recycled voice
+		Init();
+	}
+
+	template<int32 NumChannels>
+	void TMultichannelVCFOperator<NumChannels>::Init()
+	{
+		for (DSPProcessing::CytomicSVF& Filter : mCytomicSVFs)
+		{
+			VCFNode::SetFilterType(Filter, *mFilterType);
 		}
 	}
 
 	METASOUND_REGISTER_NODE(FVCFNode)
+	METASOUND_REGISTER_NODE(FVCFStereoNode)
+	METASOUND_REGISTER_NODE(FVCFQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -11,21 +11,17 @@ namespace Metasound
 	{
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
+			METASOUND_PARAM(InParamNameAntiAliasing, "Anti-Aliasing", "How the aliasing this nonlinearity generates is suppressed. Oversampling adds latency, see the Latency output.")
+
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+			METASOUND_PARAM(OutParamNameLatency, "Latency", "Delay added by the anti-aliasing mode.")
 	}
 
 	//------------------------------------------------------------------------------------
 	// FWrapOperator
 	//------------------------------------------------------------------------------------
-	FWrapOperator::FWrapOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
-		: AudioInput(InAudioInput)
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
-	{
-
-	}
-
-	const FNodeClassMetadata& FWrapOperator::GetNodeInfo()
+	const FNodeClassMetadata& FWrapNodeOp::GetNodeInfo()
 	{
 		auto InitNodeInfo = []() -> FNodeClassMetadata
 			{
@@ -33,7 +29,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Wrap (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 1;
 				Info.DisplayName = LOCTEXT("Metasound_WrapDisplayName", "Wrap (Audio)");
 				Info.Description = LOCTEXT("Metasound_WrapNodeDescription", "Applies Wrap to the audio input.");
 				Info.Author = PluginAuthor;
@@ -49,59 +45,55 @@ namespace Metasound
 		return Info;
 	}
 
-	void FWrapOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace WrapNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
-	}
-
-	void FWrapOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
-	{
-		using namespace WrapNode;
-
-		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
-	}
-
-	const FVertexInterface& FWrapOperator::GetVertexInterface()
+	const FVertexInterface& FWrapNodeOp::GetVertexInterface()
 	{
 		using namespace WrapNode;
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FEnumAntiAliasing>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAntiAliasing), (int32)DSPProcessing::EAntiAliasing::None)),
 
 			FOutputVertexInterface(
-				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio)),
+				TOutputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameLatency))
 			)
 		);
 
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FWrapOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	FVertexName FWrapNodeOp::GetInputName()
 	{
 		using namespace WrapNode;
 
-		const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
-		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		return METASOUND_GET_PARAM_NAME(InParamNameAudioInput);
+	}
 
-		FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+	FVertexName FWrapNodeOp::GetOutputName()
+	{
+		using namespace WrapNode;
 
-		return MakeUnique<FWrapOperator>(InParams.OperatorSettings, AudioIn);
+		return METASOUND_GET_PARAM_NAME(OutParamNameAudio);
 	}
 
-	void FWrapOperator::Execute()
+	FVertexName FWrapNodeOp::GetAntiAliasingName()
 	{
-		const float* InputAudio = AudioInput->GetData();
-		float* OutputAudio = AudioOutput->GetData();
+		using namespace WrapNode;
+
+		return METASOUND_GET_PARAM_NAME(InParamNameAntiAliasing);
+	}
 
-		const int32 NumSamples = AudioInput->Num();
+	FVertexName FWrapNodeOp::GetLatencyName()
+	{
+		using namespace WrapNode;
 
-		WrapDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+		return METASOUND_GET_PARAM_NAME(OutParamNameLatency);
 	}
 
 	METASOUND_REGISTER_NODE(FWrapNode)
+	METASOUND_REGISTER_NODE(FWrapStereoNode)
+	METASOUND_REGISTER_NODE(FWrapQuadNode)
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -2,10 +2,13 @@
 // All code under MIT license: see https://mit-license.org/
 
 #include "MetasoundsAudioMathUtils.h"
+#include "CoefficientDesigner.h"
 #include "MetasoundFrontendRegistries.h"
 
 #define LOCTEXT_NAMESPACE "FMetasoundsAudioMathUtilsModule"
 
+DEFINE_LOG_CATEGORY(LogMetasoundsAudioMathUtils);
+
 void FMetasoundsAudioMathUtilsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -16,6 +19,7 @@ void FMetasoundsAudioMathUtilsModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	DSPProcessing::FCoefficientDesignWorker::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
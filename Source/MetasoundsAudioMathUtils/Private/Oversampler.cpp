@@ -0,0 +1,227 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "Oversampler.h"
+#include "AudioUtils.h"
+
+namespace DSPProcessing
+{
+	namespace OversamplerPrivate
+	{
+		// Blackman windowed halfband, returning the 2K non-zero taps h[0], h[2], ... h[4K - 2] scaled to unity DC gain.
+		// The window's ~75 dB sidelobes sit below what the nonlinear stages fold back.
+		void DesignHalfband(const int32 InHalfLength, const float InGain, TArray<float>& OutTaps)
+		{
+			const int32 NumTaps = 4 * InHalfLength - 1;
+			const int32 Centre = 2 * InHalfLength - 1;
+
+			OutTaps.SetNumUninitialized(2 * InHalfLength);
+
+			double Sum = 0.0;
+			for (int32 Index = 0; Index < OutTaps.Num(); ++Index)
+			{
+				const int32 TapIndex = 2 * Index;
+				const double Offset = 0.5 * (TapIndex - Centre);
+				const double Sinc = FMath::Sin(UE_DOUBLE_PI * Offset) / (UE_DOUBLE_PI * Offset);
+				const double Phase = 2.0 * UE_DOUBLE_PI * TapIndex / (NumTaps - 1);
+				const double Window = 0.42 - 0.5 * FMath::Cos(Phase) + 0.08 * FMath::Cos(2.0 * Phase);
+
+				OutTaps[Index] = (float)(0.5 * Sinc * Window);
+				Sum += OutTaps[Index];
+			}
+
+			// the odd taps sum to 0.5 in an ideal halfband, the centre tap supplies the other half
+			const float Scale = (float)(0.5 * InGain / Sum);
+			for (float& Tap : OutTaps)
+			{
+				Tap *= Scale;
+			}
+		}
+	}
+
+	void FHalfbandUpsampler::Init(const int32 InHalfLength, const int32 InMaxNumInputSamples)
+	{
+		mHalfLength = InHalfLength;
+
+		// zero stuffing halves the level, the taps make it back up
+		OversamplerPrivate::DesignHalfband(InHalfLength, 2.0f, mTaps);
+
+		mHistory.SetNumZeroed(2 * InHalfLength - 1 + InMaxNumInputSamples);
+		mEvenPhase.SetNumZeroed(InMaxNumInputSamples);
+	}
+
+	void FHalfbandUpsampler::Reset()
+	{
+		FMemory::Memzero(mHistory.GetData(), mHistory.Num() * sizeof(float));
+	}
+
+	void FHalfbandUpsampler::Process(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		const int32 NumHistory = 2 * mHalfLength - 1;
+		float* History = mHistory.GetData();
+
+		FMemory::Memcpy(&History[NumHistory], InBuffer, InNumSamples * sizeof(float));
+
+		// taps are symmetric, so correlation order is already convolution order
+		ConvolveValid(History, mTaps.GetData(), mTaps.Num(), mEvenPhase.GetData(), InNumSamples);
+
+		// the odd phase is the centre tap alone: the input delayed by K - 1 samples
+		const float* OddPhase = &History[mHalfLength];
+		const float* EvenPhase = mEvenPhase.GetData();
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			OutBuffer[2 * Index] = EvenPhase[Index];
+			OutBuffer[2 * Index + 1] = OddPhase[Index];
+		}
+
+		FMemory::Memmove(History, &History[InNumSamples], NumHistory * sizeof(float));
+	}
+
+	void FHalfbandDownsampler::Init(const int32 InHalfLength, const int32 InMaxNumOutputSamples)
+	{
+		mHalfLength = InHalfLength;
+
+		OversamplerPrivate::DesignHalfband(InHalfLength, 1.0f, mTaps);
+
+		mEvenHistory.SetNumZeroed(2 * InHalfLength - 1 + InMaxNumOutputSamples);
+		mOddHistory.SetNumZeroed(InHalfLength + InMaxNumOutputSamples);
+	}
+
+	void FHalfbandDownsampler::Reset()
+	{
+		FMemory::Memzero(mEvenHistory.GetData(), mEvenHistory.Num() * sizeof(float));
+		FMemory::Memzero(mOddHistory.GetData(), mOddHistory.Num() * sizeof(float));
+	}
+
+	void FHalfbandDownsampler::Process(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		const int32 NumEvenHistory = 2 * mHalfLength - 1;
+		const int32 NumOddHistory = mHalfLength;
+		float* EvenHistory = mEvenHistory.GetData();
+		float* OddHistory = mOddHistory.GetData();
+
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			EvenHistory[NumEvenHistory + Index] = InBuffer[2 * Index];
+			OddHistory[NumOddHistory + Index] = InBuffer[2 * Index + 1];
+		}
+
+		ConvolveValid(EvenHistory, mTaps.GetData(), mTaps.Num(), OutBuffer, InNumSamples);
+
+		// centre tap, on the odd input K samples back
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			OutBuffer[Index] += 0.5f * OddHistory[Index];
+		}
+
+		FMemory::Memmove(EvenHistory, &EvenHistory[InNumSamples], NumEvenHistory * sizeof(float));
+		FMemory::Memmove(OddHistory, &OddHistory[InNumSamples], NumOddHistory * sizeof(float));
+	}
+
+	void FOversampler::Init(const int32 InMaxNumSamples)
+	{
+		mUpsamplers[0].Init(FirstStageHalfLength, InMaxNumSamples);
+		mDownsamplers[0].Init(FirstStageHalfLength, InMaxNumSamples);
+		mUpsamplers[1].Init(SecondStageHalfLength, 2 * InMaxNumSamples);
+		mDownsamplers[1].Init(SecondStageHalfLength, 2 * InMaxNumSamples);
+
+		mOversampled.SetNumZeroed(MaxFactor * InMaxNumSamples);
+		mIntermediate.SetNumZeroed(2 * InMaxNumSamples);
+		mOperand.SetNumZeroed(MaxFactor * InMaxNumSamples);
+	}
+
+	void FOversampler::Reset()
+	{
+		for (int32 Stage = 0; Stage < 2; ++Stage)
+		{
+			mUpsamplers[Stage].Reset();
+			mDownsamplers[Stage].Reset();
+		}
+	}
+
+	void FOversampler::SetFactor(const int32 InFactor)
+	{
+		const int32 Factor = InFactor >= 4 ? 4 : (InFactor >= 2 ? 2 : 1);
+		if (Factor != mFactor)
+		{
+			mFactor = Factor;
+			Reset();
+		}
+	}
+
+	float FOversampler::GetLatencyInSamples() const
+	{
+		float Latency = 0.0f;
+
+		if (mFactor >= 2)
+		{
+			Latency += (mUpsamplers[0].GetLatency() + mDownsamplers[0].GetLatency()) / 2.0f;
+		}
+		if (mFactor >= 4)
+		{
+			Latency += (mUpsamplers[1].GetLatency() + mDownsamplers[1].GetLatency()) / 4.0f;
+		}
+
+		return Latency;
+	}
+
+	float* FOversampler::Upsample(const float* InBuffer, const int32 InNumSamples)
+	{
+		float* Oversampled = mOversampled.GetData();
+
+		switch (mFactor)
+		{
+		case 4:
+			mUpsamplers[0].Process(InBuffer, mIntermediate.GetData(), InNumSamples);
+			mUpsamplers[1].Process(mIntermediate.GetData(), Oversampled, 2 * InNumSamples);
+			break;
+
+		case 2:
+			mUpsamplers[0].Process(InBuffer, Oversampled, InNumSamples);
+			break;
+
+		default:
+			FMemory::Memcpy(Oversampled, InBuffer, InNumSamples * sizeof(float));
+			break;
+		}
+
+		return Oversampled;
+	}
+
+	const float* FOversampler::HoldOperand(const float* InBuffer, const int32 InNumSamples)
+	{
+		float* Operand = mOperand.GetData();
+
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			for (int32 Repeat = 0; Repeat < mFactor; ++Repeat)
+			{
+				Operand[Index * mFactor + Repeat] = InBuffer[Index];
+			}
+		}
+
+		return Operand;
+	}
+
+	void FOversampler::Downsample(float* OutBuffer, const int32 InNumSamples)
+	{
+		const float* Oversampled = mOversampled.GetData();
+
+		switch (mFactor)
+		{
+		case 4:
+			mDownsamplers[1].Process(Oversampled, mIntermediate.GetData(), 2 * InNumSamples);
+			mDownsamplers[0].Process(mIntermediate.GetData(), OutBuffer, InNumSamples);
+			break;
+
+		case 2:
+			mDownsamplers[0].Process(Oversampled, OutBuffer, InNumSamples);
+			break;
+
+		default:
+			FMemory::Memcpy(OutBuffer, Oversampled, InNumSamples * sizeof(float));
+			break;
+		}
+	}
+
+} // namespace DSPProcessing
@@ -0,0 +1,187 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "PolyphaseResampler.h"
+#include "AudioUtils.h"
+#include "Math/VectorRegister.h"
+
+namespace DSPProcessing
+{
+	namespace PolyphaseResamplerPrivate
+	{
+		constexpr uint64 FractionOne = 1ull << 32;
+
+		// Highest ratio followed, reading 64 times faster than real time only ever hits the clamp anyway.
+		constexpr float MaxRatio = 64.0f;
+
+		FORCEINLINE float DotProduct16(const float* InSignal, const float* InTaps)
+		{
+			static_assert(FPolyphaseFilterTable::NumTaps == 16, "DotProduct16 is unrolled for 16 taps");
+
+			VectorRegister4Float Sum = VectorMultiply(VectorLoad(&InSignal[0]), VectorLoadAligned(&InTaps[0]));
+			Sum = VectorMultiplyAdd(VectorLoad(&InSignal[4]), VectorLoadAligned(&InTaps[4]), Sum);
+			Sum = VectorMultiplyAdd(VectorLoad(&InSignal[8]), VectorLoadAligned(&InTaps[8]), Sum);
+			Sum = VectorMultiplyAdd(VectorLoad(&InSignal[12]), VectorLoadAligned(&InTaps[12]), Sum);
+
+			alignas(16) float Lanes[4];
+			VectorStoreAligned(Sum, Lanes);
+			return (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		}
+	}
+
+	void FPolyphaseFilterTable::Design(const float InCutoff)
+	{
+		constexpr int32 HalfTaps = NumTaps / 2;
+
+		mCutoff = FMath::Clamp(InCutoff, 0.01f, 1.0f);
+		mTaps.SetNumUninitialized(NumPhases * NumTaps);
+
+		for (int32 Phase = 0; Phase < NumPhases; ++Phase)
+		{
+			const double Fraction = (double)Phase / NumPhases;
+			float* Taps = &mTaps[Phase * NumTaps];
+
+			// tap i sits on input sample (HalfTaps - 1 - i) before the read position, so the window spans
+			// (-HalfTaps, HalfTaps] around it
+			double Sum = 0.0;
+			for (int32 Tap = 0; Tap < NumTaps; ++Tap)
+			{
+				const double Offset = (Tap - (HalfTaps - 1)) - Fraction;
+				const double X = mCutoff * Offset;
+				const double Sinc = FMath::Abs(X) < 1.0e-9 ? 1.0 : FMath::Sin(UE_DOUBLE_PI * X) / (UE_DOUBLE_PI * X);
+
+				// Blackman-Harris over the NumTaps + 1 wide span the taps sample
+				const double WindowPhase = 2.0 * UE_DOUBLE_PI * (Offset + HalfTaps) / (2.0 * HalfTaps);
+				const double Window = 0.35875 - 0.48829 * FMath::Cos(WindowPhase) + 0.14128 * FMath::Cos(2.0 * WindowPhase) - 0.01168 * FMath::Cos(3.0 * WindowPhase);
+
+				Taps[Tap] = (float)(Sinc * Window);
+				Sum += Taps[Tap];
+			}
+
+			// unity gain at DC for every phase, so a constant input stays constant whatever the ratio
+			for (int32 Tap = 0; Tap < NumTaps; ++Tap)
+			{
+				Taps[Tap] = (float)(Taps[Tap] / Sum);
+			}
+		}
+	}
+
+	FPolyphaseResampler::FPolyphaseResampler()
+	{
+		mRing.SetNumZeroed(RingSize + FPolyphaseFilterTable::NumTaps);
+		mTable.Design(GetCutoffForRatio(1.0f));
+		Reset();
+	}
+
+	void FPolyphaseResampler::Reset()
+	{
+		FMemory::Memzero(mRing.GetData(), mRing.Num() * sizeof(float));
+
+		// start a full ring of silence in, reading at the ratio 1 latency
+		mNumWritten = RingSize;
+		mReadPosition = (mNumWritten - Latency) << 32;
+	}
+
+	void FPolyphaseResampler::SetCutoff(const float InCutoff)
+	{
+		if (InCutoff != mTable.GetCutoff())
+		{
+			mTable.Design(InCutoff);
+		}
+
+		mActiveTable = &mTable;
+	}
+
+	void FPolyphaseResampler::SetFilterTable(const FPolyphaseFilterTable* InTable)
+	{
+		mActiveTable = InTable != nullptr ? InTable : &mTable;
+	}
+
+	float FPolyphaseResampler::GetCutoffForRatio(const float InRatio)
+	{
+		// a little under Nyquist so the 16 tap transition band stays mostly above the passband
+		return 0.9f / FMath::Max(InRatio, 1.0f);
+	}
+
+	uint64 FPolyphaseResampler::RatioToIncrement(const float InRatio)
+	{
+		const float Ratio = FMath::Clamp(InRatio, 0.0f, PolyphaseResamplerPrivate::MaxRatio);
+		return (uint64)((double)Ratio * PolyphaseResamplerPrivate::FractionOne);
+	}
+
+	void FPolyphaseResampler::Write(const float* InBuffer, const int32 InNumSamples)
+	{
+		float* Ring = mRing.GetData();
+
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			const int32 RingIndex = (int32)((mNumWritten + Index) & (RingSize - 1));
+			Ring[RingIndex] = InBuffer[Index];
+
+			// mirror the start past the end so windows that wrap stay contiguous
+			if (RingIndex < FPolyphaseFilterTable::NumTaps)
+			{
+				Ring[RingSize + RingIndex] = InBuffer[Index];
+			}
+		}
+
+		mNumWritten += InNumSamples;
+	}
+
+	void FPolyphaseResampler::ClampReadPosition()
+	{
+		constexpr int32 HalfTaps = FPolyphaseFilterTable::NumTaps / 2;
+
+		// the newest window ends on the last sample written
+		const uint64 Newest = (mNumWritten - 1 - HalfTaps) << 32;
+		// the oldest window starts after the slot the next block overwrites
+		const uint64 Oldest = (mNumWritten - RingSize + HalfTaps + 1) << 32;
+
+		mReadPosition = FMath::Clamp(mReadPosition, Oldest, Newest);
+	}
+
+	FORCEINLINE float FPolyphaseResampler::ReadSample()
+	{
+		constexpr int32 HalfTaps = FPolyphaseFilterTable::NumTaps / 2;
+		constexpr int32 PhaseShift = 32 - FPolyphaseFilterTable::PhaseBits;
+
+		const uint64 Integer = mReadPosition >> 32;
+		const int32 Phase = (int32)((mReadPosition & 0xFFFFFFFFull) >> PhaseShift);
+		const int32 WindowStart = (int32)((Integer - (HalfTaps - 1)) & (RingSize - 1));
+
+		return PolyphaseResamplerPrivate::DotProduct16(&mRing[WindowStart], mActiveTable->GetPhase(Phase));
+	}
+
+	void FPolyphaseResampler::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InRatio, const int32 InNumSamples)
+	{
+		if (IsBufferUniform(InRatio, InNumSamples))
+		{
+			ProcessAudioBuffer(InBuffer, OutBuffer, InRatio[0], InNumSamples);
+			return;
+		}
+
+		Write(InBuffer, InNumSamples);
+
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			ClampReadPosition();
+			OutBuffer[Index] = ReadSample();
+			mReadPosition += RatioToIncrement(InRatio[Index]);
+		}
+	}
+
+	void FPolyphaseResampler::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InRatio, const int32 InNumSamples)
+	{
+		Write(InBuffer, InNumSamples);
+
+		const uint64 Increment = RatioToIncrement(InRatio);
+
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			ClampReadPosition();
+			OutBuffer[Index] = ReadSample();
+			mReadPosition += Increment;
+		}
+	}
+
+} // namespace DSPProcessing
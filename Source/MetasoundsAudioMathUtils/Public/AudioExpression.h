@@ -0,0 +1,100 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace DSPProcessing
+{
+	// Small audio rate expression language, compiled once into register bytecode and run over each block
+	// in fixed size chunks so intermediate values stay in cache rather than in full size audio buffers.
+	//
+	// Inputs:    x, y, z, w
+	// Constants: numbers (1, 0.5, 2e-3), pi
+	// Operators: + - * /, < > <= >= == != (1 if true, 0 if false), unary -, ( )
+	// Functions: sin(a), cos(a), sqrt(a), pow(a, b), wrap(a), gate(a, g), abs(a), min(a, b), max(a, b)
+	//
+	// Division by zero is zero and sin/cos/sqrt/pow/wrap/gate behave like their nodes in this plugin.
+	//
+	// When compiled with state, the expression runs one sample at a time and may start with assignments to
+	// the z^-1 registers s0..s3, e.g. "s0 = s0 * 0.99 + x * 0.01; s0". Reading sN always yields the value
+	// from the previous sample, assignments take effect for the next one.
+	class METASOUNDSAUDIOMATHUTILS_API FAudioExpression
+	{
+	public:
+		static constexpr int32 MaxInputs = 4;
+		static constexpr int32 MaxStates = 4;
+		static constexpr int32 ChunkSize = 64;
+
+		// Returns false and fills OutError if the expression can't be compiled, in which case the output is silent.
+		// bInAllowState enables the s0..s3 registers, which need ProcessAudioBufferPerSample.
+		bool Compile(const FString& InExpression, FString& OutError, const bool bInAllowState = false);
+		bool IsValid() const { return Program.Num() > 0; }
+
+		// InBuffers holds MaxInputs input buffers, one per variable.
+		void ProcessAudioBuffer(const float* const* InBuffers, float* OutBuffer, const int32 InNumSamples);
+
+		// Runs the whole program once per sample so state registers can feed back with a single sample delay.
+		void ProcessAudioBufferPerSample(const float* const* InBuffers, float* OutBuffer, const int32 InNumSamples);
+
+		// Clears the state registers.
+		void Reset();
+
+		enum class EOpCode : uint8
+		{
+			Copy,
+			Negate,
+			Add,
+			Subtract,
+			Multiply,
+			Divide,
+			Less,
+			Greater,
+			LessEqual,
+			GreaterEqual,
+			Equal,
+			NotEqual,
+			Sin,
+			Cos,
+			Sqrt,
+			Pow,
+			Wrap,
+			Gate,
+			Abs,
+			Min,
+			Max
+		};
+
+		struct FInstruction
+		{
+			EOpCode OpCode;
+			uint8 Dest;
+			uint8 A;
+			uint8 B;
+		};
+
+		// Register layout: inputs, then the output, then states, then constants, then temporaries.
+		static constexpr int32 OutputRegister = MaxInputs;
+		static constexpr int32 FirstStateRegister = MaxInputs + 1;
+		static constexpr int32 FirstConstantRegister = FirstStateRegister + MaxStates;
+		static constexpr int32 MaxRegisters = 256;
+
+		// Single sample evaluation of an opcode, matching the block implementation.
+		static float EvaluateScalar(const EOpCode InOpCode, const float A, const float B);
+
+	private:
+		void ProcessChunk(const float* const* InBuffers, float* OutBuffer, const int32 InOffset, const int32 InNumSamples);
+
+		TArray<FInstruction> Program;
+		TArray<float> ConstantValues;
+		int32 NumTemporaries = 0;
+
+		// ChunkSize floats per constant and temporary register
+		TArray<float> RegisterMemory;
+		TArray<float*> Registers;
+
+		// one value per register for per sample evaluation, state registers persist across blocks
+		TArray<float> ScalarRegisters;
+	};
+} // namespace DSPProcessing
@@ -0,0 +1,192 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "HAL/ThreadSafeCounter.h"
+
+#include <atomic>
+
+namespace Metasound
+{
+	// One interval measured by a Timer node.
+	struct FTimerIntervalEvent
+	{
+		// sample index, counted from when the operator was built or reset, at which the trigger arrived
+		int64 TriggerSample = 0;
+
+		// samples since the previous trigger
+		int64 IntervalSamples = 0;
+
+		float SampleRate = 0.0f;
+
+		double GetIntervalSeconds() const
+		{
+			return SampleRate > 0.0f ? (double)IntervalSamples / SampleRate : 0.0;
+		}
+	};
+
+	// Summary of one block seen by a Probe node. Fixed size so pushing it never allocates.
+	struct FProbeBlockSummary
+	{
+		static constexpr int32 MaxWaveformPoints = 64;
+
+		// sample index, counted from when the operator was built or reset, of the block's first frame
+		int64 BlockStartSample = 0;
+
+		int32 NumSamples = 0;
+		float SampleRate = 0.0f;
+
+		float Peak = 0.0f;
+		float Rms = 0.0f;
+		float Min = 0.0f;
+		float Max = 0.0f;
+
+		// decimated waveform, empty unless the probe's Decimation input is above zero
+		int32 NumWaveformPoints = 0;
+		float Waveform[MaxWaveformPoints];
+	};
+
+	// Lock-free single producer / single consumer queue from a node on the audio render thread to game thread
+	// code. Push never blocks or allocates; if the reader falls behind, new events are dropped and counted.
+	template<typename ElementType>
+	class TAudioMathEventChannel
+	{
+	public:
+		explicit TAudioMathEventChannel(const uint32 InCapacity)
+			: Queue(InCapacity)
+		{
+		}
+
+		// audio render thread
+		void Push(const ElementType& InElement)
+		{
+			if (!Queue.Enqueue(InElement))
+			{
+				NumDropped.Increment();
+			}
+		}
+
+		// reading thread
+		bool Pop(ElementType& OutElement)
+		{
+			return Queue.Dequeue(OutElement);
+		}
+
+		int32 GetNumDropped() const
+		{
+			return NumDropped.GetValue();
+		}
+
+		// The queue only supports one producer, so a node must claim the channel before pushing. False if another
+		// node (or another voice of the same graph) already holds it.
+		bool TryClaimWriter()
+		{
+			return !bHasWriter.exchange(true, std::memory_order_acq_rel);
+		}
+
+		void ReleaseWriter()
+		{
+			bHasWriter.store(false, std::memory_order_release);
+		}
+
+	private:
+		TCircularQueue<ElementType> Queue;
+		FThreadSafeCounter NumDropped;
+		std::atomic<bool> bHasWriter { false };
+	};
+
+	// A node's claim on a channel, released when the node's operator is destroyed. Invalid if the name was empty or
+	// the channel already had a writer.
+	template<typename ElementType>
+	class TAudioMathEventWriter
+	{
+	public:
+		using FChannelPtr = TSharedPtr<TAudioMathEventChannel<ElementType>, ESPMode::ThreadSafe>;
+
+		TAudioMathEventWriter() = default;
+
+		explicit TAudioMathEventWriter(const FChannelPtr& InChannel)
+		{
+			if (InChannel.IsValid() && InChannel->TryClaimWriter())
+			{
+				Channel = InChannel;
+			}
+		}
+
+		~TAudioMathEventWriter()
+		{
+			if (Channel.IsValid())
+			{
+				Channel->ReleaseWriter();
+			}
+		}
+
+		TAudioMathEventWriter(const TAudioMathEventWriter&) = delete;
+		TAudioMathEventWriter& operator=(const TAudioMathEventWriter&) = delete;
+
+		TAudioMathEventWriter(TAudioMathEventWriter&& InOther)
+			: Channel(MoveTemp(InOther.Channel))
+		{
+			InOther.Channel.Reset();
+		}
+
+		TAudioMathEventWriter& operator=(TAudioMathEventWriter&& InOther)
+		{
+			if (this != &InOther)
+			{
+				if (Channel.IsValid())
+				{
+					Channel->ReleaseWriter();
+				}
+
+				Channel = MoveTemp(InOther.Channel);
+				InOther.Channel.Reset();
+			}
+
+			return *this;
+		}
+
+		bool IsValid() const
+		{
+			return Channel.IsValid();
+		}
+
+		// audio render thread
+		void Push(const ElementType& InElement)
+		{
+			Channel->Push(InElement);
+		}
+
+	private:
+		FChannelPtr Channel;
+	};
+
+	using FTimerEventChannel = TAudioMathEventChannel<FTimerIntervalEvent>;
+	using FTimerEventChannelPtr = TSharedPtr<FTimerEventChannel, ESPMode::ThreadSafe>;
+
+	using FTimerEventWriter = TAudioMathEventWriter<FTimerIntervalEvent>;
+
+	using FProbeEventChannel = TAudioMathEventChannel<FProbeBlockSummary>;
+	using FProbeEventChannelPtr = TSharedPtr<FProbeEventChannel, ESPMode::ThreadSafe>;
+	using FProbeEventWriter = TAudioMathEventWriter<FProbeBlockSummary>;
+
+	// Named channels, so gameplay code can find the queue a node writes to. The registry only locks on lookup,
+	// which nodes do when they are built, never per block. Each name has at most one writing node at a time, the
+	// first to claim it; any other node naming the same channel publishes nothing. Each name should have one reader.
+	class METASOUNDSAUDIOMATHUTILS_API FAudioMathEventChannels
+	{
+	public:
+		static constexpr uint32 ChannelCapacity = 1024;
+
+		// for readers
+		static FTimerEventChannelPtr FindOrAddTimerChannel(const FName InName);
+		static FProbeEventChannelPtr FindOrAddProbeChannel(const FName InName);
+
+		// for nodes, invalid (with a warning) if the channel already has a writer
+		static FTimerEventWriter ClaimTimerWriter(const FName InName);
+		static FProbeEventWriter ClaimProbeWriter(const FName InName);
+	};
+}
@@ -0,0 +1,441 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "AudioUtils.h"
+
+namespace DSPProcessing
+{
+	// Kernel buffers come from FAudioBuffer or TArray storage, both at least 16 byte aligned, so the four-wide
+	// bodies use aligned loads and stores. Offsets into a buffer must stay multiples of four samples.
+	constexpr int32 KernelAlignment = 16;
+
+	// Block loops shared by the element-wise math kernels.
+	//
+	// An op supplies a scalar functor and, when bHasVector is true, a four-wide functor:
+	//   static float Scalar(const float A [, const float B]);
+	//   static VectorRegister4Float Vector(const VectorRegister4Float& A [, const VectorRegister4Float& B]);
+	// Both must produce the same results so the vector body and scalar remainder agree. Where the vector functor
+	// is an approximation, e.g. VectorSin, the scalar one evaluates it on a broadcast register instead of calling
+	// the scalar library function.
+	// Silence and uniform input shortcuts stay with the kernel classes in AudioUtils.h, which call these.
+	//
+	// Aliasing: Process requires the output not to overlap any input, which lets the compiler keep values in
+	// registers across the loop. ProcessInPlace reads and writes one buffer. ProcessAudioBuffer picks between
+	// them for callers that may pass the same buffer twice; partially overlapping buffers are not supported.
+	template<typename FOp>
+	struct TUnaryKernel
+	{
+		static void Process(const float* RESTRICT InBuffer, float* RESTRICT OutBuffer, const int32 InNumSamples)
+		{
+			checkSlow(IsAligned(InBuffer, KernelAlignment) && IsAligned(OutBuffer, KernelAlignment));
+
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InBuffer[Index])), &OutBuffer[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				OutBuffer[Index] = FOp::Scalar(InBuffer[Index]);
+			}
+		}
+
+		static void ProcessInPlace(float* InOutBuffer, const int32 InNumSamples)
+		{
+			checkSlow(IsAligned(InOutBuffer, KernelAlignment));
+
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InOutBuffer[Index])), &InOutBuffer[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				InOutBuffer[Index] = FOp::Scalar(InOutBuffer[Index]);
+			}
+		}
+
+		static void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+		{
+			if (InBuffer == OutBuffer)
+			{
+				ProcessInPlace(OutBuffer, InNumSamples);
+			}
+			else
+			{
+				Process(InBuffer, OutBuffer, InNumSamples);
+			}
+		}
+	};
+
+	template<typename FOp>
+	struct TBinaryKernel
+	{
+		static void Process(const float* RESTRICT InBuffer, float* RESTRICT OutBuffer, const float* RESTRICT InOperand, const int32 InNumSamples)
+		{
+			checkSlow(IsAligned(InBuffer, KernelAlignment) && IsAligned(OutBuffer, KernelAlignment) && IsAligned(InOperand, KernelAlignment));
+
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InBuffer[Index]), VectorLoadAligned(&InOperand[Index])), &OutBuffer[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				OutBuffer[Index] = FOp::Scalar(InBuffer[Index], InOperand[Index]);
+			}
+		}
+
+		// second input broadcast across the block
+		static void Process(const float* RESTRICT InBuffer, float* RESTRICT OutBuffer, const float InOperand, const int32 InNumSamples)
+		{
+			checkSlow(IsAligned(InBuffer, KernelAlignment) && IsAligned(OutBuffer, KernelAlignment));
+
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const VectorRegister4Float Operand = VectorSetFloat1(InOperand);
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InBuffer[Index]), Operand), &OutBuffer[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				OutBuffer[Index] = FOp::Scalar(InBuffer[Index], InOperand);
+			}
+		}
+
+		// InOperand may be InOutBuffer itself
+		static void ProcessInPlace(float* InOutBuffer, const float* InOperand, const int32 InNumSamples)
+		{
+			checkSlow(IsAligned(InOutBuffer, KernelAlignment) && IsAligned(InOperand, KernelAlignment));
+
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InOutBuffer[Index]), VectorLoadAligned(&InOperand[Index])), &InOutBuffer[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				InOutBuffer[Index] = FOp::Scalar(InOutBuffer[Index], InOperand[Index]);
+			}
+		}
+
+		static void ProcessInPlace(float* InOutBuffer, const float InOperand, const int32 InNumSamples)
+		{
+			checkSlow(IsAligned(InOutBuffer, KernelAlignment));
+
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const VectorRegister4Float Operand = VectorSetFloat1(InOperand);
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InOutBuffer[Index]), Operand), &InOutBuffer[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				InOutBuffer[Index] = FOp::Scalar(InOutBuffer[Index], InOperand);
+			}
+		}
+
+		static void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InOperand, const int32 InNumSamples)
+		{
+			if (InBuffer == OutBuffer)
+			{
+				ProcessInPlace(OutBuffer, InOperand, InNumSamples);
+			}
+			else if (InOperand == OutBuffer)
+			{
+				// only the operand is overwritten, which the element-wise loop reads before writing
+				ProcessInPlaceOperand(InBuffer, OutBuffer, InNumSamples);
+			}
+			else
+			{
+				Process(InBuffer, OutBuffer, InOperand, InNumSamples);
+			}
+		}
+
+		static void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InOperand, const int32 InNumSamples)
+		{
+			if (InBuffer == OutBuffer)
+			{
+				ProcessInPlace(OutBuffer, InOperand, InNumSamples);
+			}
+			else
+			{
+				Process(InBuffer, OutBuffer, InOperand, InNumSamples);
+			}
+		}
+
+	private:
+		static void ProcessInPlaceOperand(const float* InBuffer, float* InOutOperand, const int32 InNumSamples)
+		{
+			int32 Index = 0;
+
+			if constexpr (FOp::bHasVector)
+			{
+				const int32 NumVectorSamples = InNumSamples & ~3;
+				for (; Index < NumVectorSamples; Index += 4)
+				{
+					VectorStoreAligned(FOp::Vector(VectorLoadAligned(&InBuffer[Index]), VectorLoadAligned(&InOutOperand[Index])), &InOutOperand[Index]);
+				}
+			}
+
+			for (; Index < InNumSamples; ++Index)
+			{
+				InOutOperand[Index] = FOp::Scalar(InBuffer[Index], InOutOperand[Index]);
+			}
+		}
+	};
+
+	// First-order antiderivative anti-aliasing (ADAA). Each output is the mean of f over the segment between the
+	// previous and current input, (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1]), which attenuates the harmonics that
+	// would alias for about one extra antiderivative per sample, at the cost of half a sample of delay. When the
+	// segment is too short to divide by, f at its midpoint is used instead. F is evaluated in double precision
+	// as the difference of two nearby values of F would otherwise cancel.
+	//
+	// An op supplies static double Antiderivative(const double A [, const float B]), and binary ops
+	// static bool HasAntiderivative(const float B) for operands with no closed form, which use the plain kernel.
+	constexpr double AntiderivativeMinDelta = 1.0e-5;
+
+	template<typename FOp>
+	struct TUnaryAntiderivativeKernel
+	{
+		// InBuffer may be OutBuffer, each sample is read before it is written
+		static void Process(const float* InBuffer, float* OutBuffer, const int32 InNumSamples, FAntiderivativeState& InOutState)
+		{
+			float PreviousInput = InOutState.PreviousInput;
+			double PreviousAntiderivative = InOutState.PreviousAntiderivative;
+
+			for (int32 Index = 0; Index < InNumSamples; ++Index)
+			{
+				const float Input = InBuffer[Index];
+				const double Antiderivative = FOp::Antiderivative(Input);
+				const double Delta = (double)Input - PreviousInput;
+
+				OutBuffer[Index] = FMath::Abs(Delta) > AntiderivativeMinDelta
+					? (float)((Antiderivative - PreviousAntiderivative) / Delta)
+					: FOp::Scalar(0.5f * (Input + PreviousInput));
+
+				PreviousInput = Input;
+				PreviousAntiderivative = Antiderivative;
+			}
+
+			InOutState.PreviousInput = PreviousInput;
+			InOutState.PreviousAntiderivative = PreviousAntiderivative;
+		}
+	};
+
+	template<typename FOp>
+	struct TBinaryAntiderivativeKernel
+	{
+		// The operand shapes the curve, so both ends of a segment use the current operand. F(x[n-1]) is only
+		// recomputed when the operand changed, a constant operand costs one antiderivative per sample.
+		static void Process(const float* InBuffer, float* OutBuffer, const float* InOperand, const int32 InNumSamples, FAntiderivativeState& InOutState)
+		{
+			float PreviousInput = InOutState.PreviousInput;
+			float PreviousOperand = InOutState.PreviousOperand;
+			double PreviousAntiderivative = InOutState.PreviousAntiderivative;
+
+			for (int32 Index = 0; Index < InNumSamples; ++Index)
+			{
+				const float Input = InBuffer[Index];
+				const float Operand = InOperand[Index];
+
+				if (!FOp::HasAntiderivative(Operand))
+				{
+					OutBuffer[Index] = FOp::Scalar(Input, Operand);
+					PreviousInput = Input;
+					PreviousOperand = Operand;
+					continue;
+				}
+
+				if (Operand != PreviousOperand || !FOp::HasAntiderivative(PreviousOperand))
+				{
+					PreviousAntiderivative = FOp::Antiderivative(PreviousInput, Operand);
+				}
+
+				const double Antiderivative = FOp::Antiderivative(Input, Operand);
+				const double Delta = (double)Input - PreviousInput;
+
+				OutBuffer[Index] = FMath::Abs(Delta) > AntiderivativeMinDelta
+					? (float)((Antiderivative - PreviousAntiderivative) / Delta)
+					: FOp::Scalar(0.5f * (Input + PreviousInput), Operand);
+
+				PreviousInput = Input;
+				PreviousOperand = Operand;
+				PreviousAntiderivative = Antiderivative;
+			}
+
+			InOutState.PreviousInput = PreviousInput;
+			InOutState.PreviousOperand = PreviousOperand;
+			InOutState.PreviousAntiderivative = PreviousAntiderivative;
+		}
+	};
+
+	struct FSineOp
+	{
+		static constexpr bool bHasVector = true;
+
+		static FORCEINLINE float Scalar(const float A)
+		{
+			return VectorGetComponent(Vector(VectorSetFloat1(A)), 0);
+		}
+
+		static FORCEINLINE VectorRegister4Float Vector(const VectorRegister4Float& A)
+		{
+			return VectorSin(VectorMultiply(VectorSetFloat1(2.0f * PI), A));
+		}
+	};
+
+	struct FCosOp
+	{
+		static constexpr bool bHasVector = true;
+
+		static FORCEINLINE float Scalar(const float A)
+		{
+			return VectorGetComponent(Vector(VectorSetFloat1(A)), 0);
+		}
+
+		static FORCEINLINE VectorRegister4Float Vector(const VectorRegister4Float& A)
+		{
+			return VectorCos(VectorMultiply(VectorSetFloat1(2.0f * PI), A));
+		}
+	};
+
+	// sign preserving square root
+	struct FSqrtOp
+	{
+		static constexpr bool bHasVector = true;
+
+		static FORCEINLINE float Scalar(const float A)
+		{
+			return (A < 0 ? -1 : 1) * FMath::Sqrt(FMath::Abs(A));
+		}
+
+		static FORCEINLINE VectorRegister4Float Vector(const VectorRegister4Float& A)
+		{
+			const VectorRegister4Float Root = VectorSqrt(VectorAbs(A));
+			return VectorSelect(VectorCompareLT(A, VectorZeroFloat()), VectorNegate(Root), Root);
+		}
+
+		// (2/3)|x|^1.5
+		static FORCEINLINE double Antiderivative(const double A)
+		{
+			const double Magnitude = FMath::Abs(A);
+			return (2.0 / 3.0) * Magnitude * FMath::Sqrt(Magnitude);
+		}
+	};
+
+	struct FWrapOp
+	{
+		static constexpr bool bHasVector = false;
+
+		static FORCEINLINE float Scalar(const float A)
+		{
+			return sWrap(A);
+		}
+
+		// sWrap is a triangle wave of period 4, so its antiderivative is a periodic parabola: x^2 / 2 on [-1, 1],
+		// 2|x| - x^2 / 2 - 1 on the falling segments out to +-2
+		static FORCEINLINE double Antiderivative(const double A)
+		{
+			const double Reduced = FMath::Abs(A - 4.0 * FMath::RoundToDouble(0.25 * A));
+			return Reduced <= 1.0 ? 0.5 * Reduced * Reduced : 2.0 * Reduced - 0.5 * Reduced * Reduced - 1.0;
+		}
+	};
+
+	// sign preserving power
+	struct FPowOp
+	{
+		static constexpr bool bHasVector = false;
+
+		static FORCEINLINE float Scalar(const float A, const float B)
+		{
+			const float PowVal = FMath::Pow(FMath::Abs(A), B);
+			return A < 0.0f ? -PowVal : PowVal;
+		}
+
+		// |x|^(p + 1) / (p + 1), which diverges at p = -1
+		static FORCEINLINE bool HasAntiderivative(const float B)
+		{
+			return B > -1.0f + 1.0e-3f;
+		}
+
+		static FORCEINLINE double Antiderivative(const double A, const float B)
+		{
+			return FMath::Pow(FMath::Abs(A), (double)B + 1.0) / ((double)B + 1.0);
+		}
+	};
+
+	// passes A while B rounds to non-zero, i.e. |B| >= 0.5
+	struct FGateOp
+	{
+		static constexpr bool bHasVector = true;
+
+		static FORCEINLINE float Scalar(const float A, const float B)
+		{
+			// same test as the vector path, so a NaN gate closes wherever the sample falls
+			return FMath::Abs(B) >= 0.5f ? A : 0.0f;
+		}
+
+		static FORCEINLINE VectorRegister4Float Vector(const VectorRegister4Float& A, const VectorRegister4Float& B)
+		{
+			return VectorSelect(VectorCompareGE(VectorAbs(B), VectorSetFloat1(0.5f)), A, VectorZeroFloat());
+		}
+	};
+
+	// divide by zero is zero
+	struct FDivideOp
+	{
+		static constexpr bool bHasVector = true;
+
+		static FORCEINLINE float Scalar(const float A, const float B)
+		{
+			return B == 0.0f ? 0.0f : A / B;
+		}
+
+		static FORCEINLINE VectorRegister4Float Vector(const VectorRegister4Float& A, const VectorRegister4Float& B)
+		{
+			const VectorRegister4Float Zero = VectorZeroFloat();
+			return VectorSelect(VectorCompareEQ(B, Zero), Zero, VectorDivide(A, B));
+		}
+	};
+} // namespace DSPProcessing
@@ -6,6 +6,13 @@
 #include "CoreMinimal.h"
 #include "HAL/Platform.h"
 
+// Per-block NaN/Inf sanitization (au.MetasoundsAudioMathUtils.SanitizeNonFinite) is compiled out of shipping builds.
+#if !UE_BUILD_SHIPPING
+#define AUDIOMATHUTILS_NONFINITE_CHECKS 1
+#else
+#define AUDIOMATHUTILS_NONFINITE_CHECKS 0
+#endif
+
 namespace DSPProcessing
 {
 
@@ -20,15 +27,150 @@ namespace DSPProcessing
 	//	-0.0656615f, 0.0701196f, -0.0295782f, -0.0153096f, 0.0361677f, -0.026739f, 0.000918963f, 0.0201139f, 
 	//	-0.022786f, 0.00858315f, 0.00957585f, -0.0180509f, 0.0121007f, 0.00201072f, -0.0129218f, 0.0129758f, 
 	//	-0.00334221f, -0.00780443f, 0.0120079f, -0.00678929f, -0.00308269f, 0.0097864f, -0.00853862f, 
-	//	0.00091773f, 0.00682457f, -0.00881646f, 0.00395832f, 0.00358686f, -0.00790079f, 0.00590667f, 0.000480447 
-	//	-0.00611859f, 0.00674355 -0.00216395 -0.00382482, 0.00655771 -0.00411038 -0.00137314,  
-	//	0.0055295 -0.0052291, 0.000915266, 0.00390557f, -0.00549833f, 0.00277942f, 0.00196776f, -0.0049956f, 
+	//	0.00091773f, 0.00682457f, -0.00881646f, 0.00395832f, 0.00358686f, -0.00790079f, 0.00590667f, 0.000480447f, 
+	//	-0.00611859f, 0.00674355f, -0.00216395f, -0.00382482f, 0.00655771f, -0.00411038f, -0.00137314f, 
+	//	0.0055295f, -0.0052291f, 0.000915266f, 0.00390557f, -0.00549833f, 0.00277942f, 0.00196776f, -0.0049956f, 
 	//	0.0040394f, 0.0f };
+	//
+	// Kept for reference only: this table passes up to ~0.7 Nyquist at -2.2 dB and stops from ~0.8, and being
+	// even length it delays by half a sample. It is not a halfband, so the oversampler (Oversampler.h) designs
+	// its own halfband filters instead.
+
+	// Recursive filter state smaller than this is snapped to zero at block boundaries so decaying
+	// tails never settle in the denormal range once a voice goes silent.
+	constexpr float DenormalSnapThreshold = 1.0e-15f;
+
+	FORCEINLINE float FlushDenormalToZero(const float InValue)
+	{
+		return FMath::Abs(InValue) < DenormalSnapThreshold ? 0.0f : InValue;
+	}
+
+	// Render quanta with their own kernel instantiations: 256 frames on console, 512 on desktop.
+	// Block kernels are templated on their length, with 0 meaning the runtime InNumSamples, so for
+	// these sizes the compiler sees a constant trip count and can unroll without remainder handling.
+	constexpr int32 ConsoleBlockSize = 256;
+	constexpr int32 DesktopBlockSize = 512;
+
+	// Returns true if every sample in the block is exactly zero (NaN counts as non-silent).
+	bool IsBufferSilent(const float* InBuffer, const int32 InNumSamples);
+
+	// Returns true if every sample in the block equals the first one, e.g. a constant promoted to audio rate.
+	bool IsBufferUniform(const float* InBuffer, const int32 InNumSamples);
+
+	// Min, max and sum of squares of a block in one SIMD pass. An empty block reports zeros.
+	struct FBlockStats
+	{
+		float Min = 0.0f;
+		float Max = 0.0f;
+		float SumOfSquares = 0.0f;
+	};
+
+	FBlockStats ComputeBlockStats(const float* InBuffer, const int32 InNumSamples);
+
+	// Writes one point per InStride samples, the sample with the largest magnitude in that span, so transients
+	// survive decimation. Returns the number of points written, ceil(InNumSamples / InStride).
+	int32 DecimatePeaks(const float* InBuffer, const int32 InNumSamples, const int32 InStride, float* OutPoints);
 
+	// Direct form FIR in correlation order: OutBuffer[n] = sum_i InTaps[i] * InSignal[n + i], for n < InNumOutput.
+	// InSignal holds InNumOutput + InNumTaps - 1 samples, i.e. the filter history followed by the new input.
+	// Pass taps reversed for a causal convolution. Four outputs are computed per vector, so no alignment is needed.
+	void ConvolveValid(const float* RESTRICT InSignal, const float* RESTRICT InTaps, const int32 InNumTaps, float* RESTRICT OutBuffer, const int32 InNumOutput);
+
+	// InOutAccumulator += InA * InB for interleaved complex (re, im) arrays, e.g. IFFTAlgorithm spectra.
+	// InNumFloats must be a multiple of 4 and all three buffers 16 byte aligned.
+	void ComplexMultiplyAdd(const float* RESTRICT InA, const float* RESTRICT InB, float* RESTRICT InOutAccumulator, const int32 InNumFloats);
+
+	// Remembers the previous block of an input so stateless nodes can skip recomputing an unchanged block.
+	class FInputBlockCache
+	{
+	public:
+		// Allocates room for one block. Call from the operator's constructor so the audio thread never allocates.
+		void Init(const int32 InNumSamples);
+
+		// True if InBuffer is bit-identical to the block passed on the previous call. Always remembers InBuffer.
+		bool MatchesPrevious(const float* InBuffer, const int32 InNumSamples);
+		void Invalidate();
+
+	private:
+		TArray<float> mPreviousBlock;
+		bool bIsValid = false;
+	};
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+	// Zeroes any NaN/Inf samples in the block when au.MetasoundsAudioMathUtils.SanitizeNonFinite is enabled.
+	// Returns true if any were replaced, in which case the caller should also reset its recursive state.
+	bool SanitizeNonFinite(float* InOutBuffer, const int32 InNumSamples, const TCHAR* InNodeName);
+#endif
+
+	// Every ProcessAudioBuffer below accepts OutBuffer == InBuffer for in-place processing. Buffers must
+	// otherwise not overlap and must be 16 byte aligned (see AudioMathKernels.h).
 	class FAudioDivide
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputGateToggle, const int32 InNumSamples);
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InputAudioDivide, const int32 InNumSamples);
+	};
+
+	enum class EClickShape : uint8
+	{
+		Impulse,	// single sample at 1
+		Doublet,	// Width samples at 1 then Width at -1, no DC
+		Triangle	// 2 * Width - 1 samples peaking at 1
+	};
+
+	// Writes click shapes at trigger frames into a buffer that otherwise stays silent. Only the samples
+	// written on the previous block are cleared, and shapes that run past the end of a block carry over.
+	class FClick
+	{
+	public:
+		// about 5 ms at 48 kHz, wider shapes stop sounding like clicks; keeps the reserved tables at 4 KiB
+		static constexpr int32 MaxWidth = 256;
+
+		FClick();
+
+		// Rebuilds the shape table only when the shape or width changed.
+		void SetShape(const EClickShape InShape, const int32 InWidth);
+
+		// Clears what the previous block wrote and adds any carried tail. Call once per block before AddClick.
+		void BeginBlock(float* OutBuffer, const int32 InNumSamples);
+
+		// Adds one click starting at InFrame; overlapping clicks sum.
+		void AddClick(float* OutBuffer, const int32 InFrame, const int32 InNumSamples);
+
+		// Forgets the carried tail and the dirty range, the caller zeroes the buffer.
+		void Reset();
+
+	private:
+		TArray<float> mShapeTable;
+		TArray<float> mCarry;
+		int32 mNumCarry = 0;
+
+		// samples [mDirtyStart, mDirtyEnd) of the current block may be non-zero
+		int32 mDirtyStart = 0;
+		int32 mDirtyEnd = 0;
+
+		EClickShape mShape = EClickShape::Impulse;
+		int32 mWidth = 1;
+	};
+
+	// Hysteresis comparator that reports edges rather than writing a 0/1 buffer. The input has to rise above
+	// Threshold + Hysteresis / 2 to go high and fall below Threshold - Hysteresis / 2 to go low again.
+	class FSchmittTrigger
+	{
+	public:
+		void SetThreshold(const float InThreshold, const float InHysteresis);
+
+		// Returns the frame of the next edge at or after InStartFrame, or InNumSamples if there is none.
+		// The search runs four samples at a time, so blocks without an edge cost one compare per group.
+		int32 FindNextEdge(const float* InBuffer, const int32 InStartFrame, const int32 InNumSamples, bool& bOutIsRising);
+
+		bool IsHigh() const { return bIsHigh; }
+		void Reset();
+
+	private:
+		float mUpperThreshold = 0.0f;
+		float mLowerThreshold = 0.0f;
+		bool bIsHigh = false;
 	};
 
 	class FCos
@@ -41,34 +183,114 @@ namespace DSPProcessing
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputGateToggle, const int32 InNumSamples);
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InputGateToggle, const int32 InNumSamples);
+	};
+
+	// Previous sample of a first-order antiderivative anti-aliased kernel (see AudioMathKernels.h).
+	struct FAntiderivativeState
+	{
+		float PreviousInput = 0.0f;
+		float PreviousOperand = 0.0f;
+		double PreviousAntiderivative = 0.0;
 	};
 
 	class FPow
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples);
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InputPowerOf, const int32 InNumSamples);
+
+		// Antiderivative anti-aliased version, half a sample late. Exponents at or below -1 have no antiderivative
+		// and use the plain kernel.
+		void ProcessAntiderivative(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples);
+
+	private:
+		FAntiderivativeState mAntiderivativeState;
 	};
 
 	class FOnePoleIIR
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples);
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples);
+		void Reset();
+
+		// Call once with FOperatorSettings::GetNumFramesPerBlock() to pick loops unrolled for that block size.
+		void SetBlockSize(const int32 InNumFramesPerBlock);
 	private:
+		template<int32 BlockSize> void ProcessModulatedBlock(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples);
+		template<int32 BlockSize> void ProcessFixedBlock(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples);
+
+		void (FOnePoleIIR::*mProcessModulatedBlock)(const float*, float*, const float*, const float*, const int32) = nullptr;
+		void (FOnePoleIIR::*mProcessFixedBlock)(const float*, float*, const float, const float, const int32) = nullptr;
+		int32 mBlockSize = 0;
+
 		float mPreviousSample = 0.0f;
 	};
 
+	// NumLanes independent one-pole IIRs, y[n] = b * x[n] + a * y[n-1], run as one. Coefficients and state are
+	// stored lane-wise (structure of arrays) so each SIMD register holds four lanes; input is transposed in
+	// 4x4 tiles so one recurrence step advances four lanes at once, then transposed back out.
+	class FOnePoleIIRBank
+	{
+	public:
+		static constexpr int32 NumLanes = 8;
+
+		FOnePoleIIRBank();
+
+		void SetCoefficients(const float InCoefA, const float InCoefB);
+		void SetCoefficients(const int32 InLane, const float InCoefA, const float InCoefB);
+		void Reset();
+
+		// InBuffers and OutBuffers each point to NumLanes buffers of InNumSamples. OutBuffers[Lane] may be
+		// InBuffers[Lane]. Groups of four lanes with silent input and settled state just write silence.
+		void ProcessAudioBuffers(const float* const* InBuffers, float* const* OutBuffers, const int32 InNumSamples);
+
+	private:
+		static constexpr int32 LanesPerGroup = 4;
+		static constexpr int32 NumGroups = NumLanes / LanesPerGroup;
+
+		void ProcessGroup(const int32 InGroup, const float* const* InBuffers, float* const* OutBuffers, const int32 InNumSamples);
+
+		alignas(16) float mCoefA[NumLanes];
+		alignas(16) float mCoefB[NumLanes];
+		alignas(16) float mState[NumLanes];
+	};
+
 	class FOnePoleFIR
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples);
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples);
+		void Reset();
+
+		// Call once with FOperatorSettings::GetNumFramesPerBlock() to pick loops unrolled for that block size.
+		void SetBlockSize(const int32 InNumFramesPerBlock);
 	private:
+		template<int32 BlockSize> void ProcessModulatedBlock(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples);
+		template<int32 BlockSize> void ProcessFixedBlock(const float* InBuffer, float* OutBuffer, const float coefA, const float coefB, const int32 InNumSamples);
+
+		void (FOnePoleFIR::*mProcessModulatedBlock)(const float*, float*, const float*, const float*, const int32) = nullptr;
+		void (FOnePoleFIR::*mProcessFixedBlock)(const float*, float*, const float, const float, const int32) = nullptr;
+		int32 mBlockSize = 0;
+
 		float mPreviousInputSample = 0.0f;
 	};
 
 	class FSamphold
 	{
 	public:
+		// Samples InBuffer each time the phasor wraps (drops below its previous value). The wrap search runs four
+		// samples at a time and the spans between wraps are filled in bulk.
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputSampholdPhasor, const int32 InNumSamples);
+
+		// Trigger driven: fills [InStartFrame, InEndFrame) with the held sample.
+		void Hold(float* OutBuffer, const int32 InStartFrame, const int32 InEndFrame) const;
+
+		// Trigger driven: samples InBuffer at InTriggerFrame and holds it up to InEndFrame.
+		void SampleAndHold(const float* InBuffer, float* OutBuffer, const int32 InTriggerFrame, const int32 InEndFrame);
+
+		void Reset();
 	private:
 		float mHeldSample = 0.0f;
 		float mPreviousPhasorValue = 0.0f;
@@ -80,17 +302,71 @@ namespace DSPProcessing
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
 	};
 
+	// A phasor feeding a sine in one pass, so the ramp never goes through a buffer. The phase is accumulated in
+	// double and wrapped every four samples, so it stays sample accurate however long the oscillator runs.
+	class FSineOscillator
+	{
+	public:
+		void Init(const float InSampleRate);
+
+		// InFrequency is in Hz and InPhaseMod in cycles, both read per sample.
+		void ProcessAudioBuffer(const float* InFrequency, const float* InPhaseMod, float* OutBuffer, const int32 InNumSamples);
+
+		void Reset();
+
+	private:
+		double mInverseSampleRate = 1.0 / 48000.0;
+		double mPhase = 0.0;
+	};
+
 	class FSqrt
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+		// Antiderivative anti-aliased version, half a sample late.
+		void ProcessAntiderivative(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+	private:
+		FAntiderivativeState mAntiderivativeState;
 	};
 
+	// Folds the input back into [-1, 1].
+	float sWrap(float input);
+
 	class FWrap
 	{
 	public:
 		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+		// Antiderivative anti-aliased version, half a sample late.
+		void ProcessAntiderivative(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+	private:
+		FAntiderivativeState mAntiderivativeState;
 	};
 
+	// Anti-aliasing for the nonlinear kernels (Pow, Wrap, Sqrt).
+	enum class EAntiAliasing : uint8
+	{
+		None,
+		Oversample2x,	// halfband oversampling, see Oversampler.h
+		Oversample4x,
+		Antiderivative	// first-order ADAA, half a sample of delay
+	};
+
+	FORCEINLINE int32 GetOversamplingFactor(const EAntiAliasing InAntiAliasing)
+	{
+		switch (InAntiAliasing)
+		{
+		case EAntiAliasing::Oversample2x:
+			return 2;
+		case EAntiAliasing::Oversample4x:
+			return 4;
+		default:
+			return 1;
+		}
+	}
+
 } // namespace DSPProcessing
 
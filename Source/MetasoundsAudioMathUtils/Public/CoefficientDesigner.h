@@ -0,0 +1,210 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+
+#include <atomic>
+
+namespace DSPProcessing
+{
+	// A designer's state as seen by the design worker.
+	class ICoefficientDesignJob
+	{
+	public:
+		virtual ~ICoefficientDesignJob() = default;
+
+		// Design worker. Runs the pending request, if any, and frees retired tables. Returns false once the owning
+		// designer is gone and everything it left behind has been freed, so the worker can drop the job.
+		virtual bool Run() = 0;
+	};
+
+	using FCoefficientDesignJobRef = TSharedRef<ICoefficientDesignJob, ESPMode::ThreadSafe>;
+
+	// One persistent thread shared by every designer, started with the first. It polls each designer's request slot
+	// every couple of milliseconds, so requesting a design never dispatches a task, takes a lock or signals an event
+	// on the audio thread.
+	class METASOUNDSAUDIOMATHUTILS_API FCoefficientDesignWorker
+	{
+	public:
+		// Takes a lock, so not from the audio thread.
+		static void AddJob(const FCoefficientDesignJobRef& InJob);
+
+		// Stops the thread, called on module shutdown.
+		static void Shutdown();
+	};
+
+	// Designs coefficient tables (any default constructible TableType) from ParamsType requests on the design worker
+	// and hands them to the audio thread without locks, so changing a filter never runs the design, or allocates or
+	// frees memory, on the audio thread.
+	//
+	// Requests are triple buffered: the audio thread fills a preallocated slot and publishes it with one atomic
+	// exchange, replacing any request the worker has not picked up yet. Designs run one at a time per designer, so
+	// tables always arrive in request order. A finished table waits in a single atomic slot until the audio thread
+	// swaps it in with Update. The table it replaces stays valid for one more Update and is then queued back to the
+	// worker to be freed.
+	//
+	// Everything the worker touches is held by shared state, so the owner can be destroyed with a design in flight;
+	// its tables are then freed on the worker too.
+	template<typename TableType, typename ParamsType>
+	class TAsyncCoefficientDesigner
+	{
+	public:
+		using FDesignFunction = TUniqueFunction<void(TableType&, const ParamsType&)>;
+
+		// Registers with the design worker, so construct off the audio thread.
+		explicit TAsyncCoefficientDesigner(FDesignFunction&& InDesign)
+			: mState(MakeShared<FState, ESPMode::ThreadSafe>(MoveTemp(InDesign)))
+		{
+			FCoefficientDesignWorker::AddJob(mState);
+		}
+
+		~TAsyncCoefficientDesigner()
+		{
+			Retire(mReplaced.Release());
+			Retire(mCurrent.Release());
+			mState->bOrphaned.store(true, std::memory_order_release);
+		}
+
+		TAsyncCoefficientDesigner(const TAsyncCoefficientDesigner&) = delete;
+		TAsyncCoefficientDesigner& operator=(const TAsyncCoefficientDesigner&) = delete;
+
+		// Runs InInit on every request slot, e.g. to reserve room so filling one never allocates. Before any request.
+		void InitParams(TFunctionRef<void(ParamsType&)> InInit)
+		{
+			for (ParamsType& Params : mState->Slots)
+			{
+				InInit(Params);
+			}
+		}
+
+		// Designs from InParams on the calling thread and makes the result current straight away. For building the
+		// first table when the owner is constructed, not for the audio thread.
+		void DesignNow(const ParamsType& InParams)
+		{
+			TUniquePtr<TableType> Table = MakeUnique<TableType>();
+			mState->Design(*Table, InParams);
+
+			mReplaced.Reset();
+			mCurrent = MoveTemp(Table);
+		}
+
+		// Audio thread. InFill(ParamsType&) writes the request into a slot owned by the audio thread, which is then
+		// published to the worker. Only InFill can allocate, and won't if the slots were reserved by InitParams.
+		template<typename FillType>
+		void RequestDesign(FillType&& InFill)
+		{
+			InFill(mState->Slots[mWriteSlot]);
+			mWriteSlot = mState->SharedSlot.exchange(mWriteSlot | NewRequestBit, std::memory_order_acq_rel) & SlotIndexMask;
+		}
+
+		// Audio thread, once per block. Returns true if a newer table was swapped in; GetReplaced then returns the
+		// table it replaced until the next call.
+		bool Update()
+		{
+			Retire(mReplaced.Release());
+
+			TableType* Newest = mState->Pending.exchange(nullptr, std::memory_order_acq_rel);
+			if (Newest == nullptr)
+			{
+				return false;
+			}
+
+			mReplaced = MoveTemp(mCurrent);
+			mCurrent.Reset(Newest);
+
+			return true;
+		}
+
+		// nullptr until the first table has been designed
+		TableType* GetCurrent() const { return mCurrent.Get(); }
+		TableType* GetReplaced() const { return mReplaced.Get(); }
+
+	private:
+		static constexpr uint32 RetireQueueCapacity = 16;
+		static constexpr uint32 SlotIndexMask = 3;
+		static constexpr uint32 NewRequestBit = 4;
+
+		struct FState : public ICoefficientDesignJob
+		{
+			explicit FState(FDesignFunction&& InDesign)
+				: Design(MoveTemp(InDesign))
+			{
+			}
+
+			virtual ~FState() override
+			{
+				delete Pending.load();
+				FreeRetired();
+			}
+
+			virtual bool Run() override
+			{
+				// read before freeing, so the tables the owner retired on its way out are freed on this pass
+				if (bOrphaned.load(std::memory_order_acquire))
+				{
+					FreeRetired();
+					return false;
+				}
+
+				if (SharedSlot.load(std::memory_order_acquire) & NewRequestBit)
+				{
+					ReadSlot = SharedSlot.exchange(ReadSlot, std::memory_order_acq_rel) & SlotIndexMask;
+
+					TableType* Table = new TableType();
+					Design(*Table, Slots[ReadSlot]);
+
+					// a table the audio thread never picked up is superseded by this one
+					delete Pending.exchange(Table, std::memory_order_acq_rel);
+				}
+
+				FreeRetired();
+				return true;
+			}
+
+			void FreeRetired()
+			{
+				TableType* Table = nullptr;
+				while (Retired.Dequeue(Table))
+				{
+					delete Table;
+				}
+			}
+
+			FDesignFunction Design;
+
+			// the audio thread fills one slot, the worker reads another, and the third is swapped between them through
+			// SharedSlot, tagged with NewRequestBit while it holds a request the worker has not taken
+			ParamsType Slots[3];
+			std::atomic<uint32> SharedSlot { 1 };
+			uint32 ReadSlot = 2;
+
+			std::atomic<TableType*> Pending { nullptr };
+			std::atomic<bool> bOrphaned { false };
+
+			// audio thread to worker, single producer / single consumer
+			TCircularQueue<TableType*> Retired { RetireQueueCapacity };
+		};
+
+		void Retire(TableType* InTable)
+		{
+			// only fills up if the worker has stalled, in which case freeing here is the lesser evil
+			if (InTable != nullptr && !mState->Retired.Enqueue(InTable))
+			{
+				delete InTable;
+			}
+		}
+
+		TSharedRef<FState, ESPMode::ThreadSafe> mState;
+		uint32 mWriteSlot = 0;
+
+		TUniquePtr<TableType> mCurrent;
+		TUniquePtr<TableType> mReplaced;
+	};
+
+} // namespace DSPProcessing
@@ -16,12 +16,29 @@ public:
 	void setHPF();
 	void setBP();
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples);
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float CutoffFreq, const float QAmount, const int32 InNumSamples);
+	void Reset();
+
+	// Call once with FOperatorSettings::GetNumFramesPerBlock() to pick loops unrolled for that block size.
+	void SetBlockSize(const int32 InNumFramesPerBlock);
 
 private:
+	void UpdateCoefficients(const float CutoffFreq, const float QAmount);
+	float ProcessSample(const float InSample);
+	void FinishBlock();
+
+	template<int32 BlockSize> void ProcessModulatedBlock(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples);
+	template<int32 BlockSize> void ProcessFixedBlock(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+	void (CytomicSVF::*mProcessModulatedBlock)(const float*, float*, const float*, const float*, const int32) = nullptr;
+	void (CytomicSVF::*mProcessFixedBlock)(const float*, float*, const int32) = nullptr;
+	int32 mBlockSize = 0;
+
 	float g = 0.0f, k = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;  // filter coefficients
 	float m0 = 0.0f, m1 = 0.0f, m2 = 0.0f;
 	float ic1eq = 0.0f, ic2eq = 0.0f;      // internal state
 	const float fs = 48000.0f;
+	const float minQ = 0.001f;	// Q = 0 would make k infinite
 };
 
 } //namespace DSPProcessing
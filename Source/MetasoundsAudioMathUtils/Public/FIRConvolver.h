@@ -0,0 +1,83 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSP/FFTAlgorithm.h"
+
+namespace DSPProcessing
+{
+	enum class EFIRMethod : uint8
+	{
+		Direct,		// SIMD time domain convolution, no latency
+		Partitioned	// uniformly partitioned overlap-save FFT convolution
+	};
+
+	// N tap FIR filter. Init picks direct or partitioned FFT convolution from a cost model and prepares the
+	// coefficients; processing after that never allocates.
+	//
+	// The partitioned path uses partitions of the block size rounded up to a power of two. With power of two
+	// block sizes each block fills exactly one partition and there is no latency, otherwise output is delayed
+	// by one partition (see GetLatency).
+	class FFIRConvolver
+	{
+	public:
+		static constexpr int32 MaxNumTaps = 1 << 16;
+
+		// Allocates and, for long filters, runs one FFT per partition.
+		void Init(const float* InTaps, const int32 InNumTaps, const int32 InBlockSize);
+		void Reset();
+
+		// Carries the input history of InOther over, so a filter swapped in for another continues without a
+		// gap. Only possible when both use the same method (and partition size), otherwise this starts from
+		// silence; a longer filter also hears silence before the history InOther kept. Copies, never allocates.
+		void CopyHistoryFrom(const FFIRConvolver& InOther);
+
+		// InBuffer may be OutBuffer. InNumSamples should be the block size passed to Init.
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+		EFIRMethod GetMethod() const { return mMethod; }
+		int32 GetNumTaps() const { return mNumTaps; }
+		int32 GetLatency() const { return mLatency; }
+
+		// Cost model, in approximate flops per output sample. The partitioned cost counts a forward and an inverse
+		// real FFT of 2P points and one complex multiply-add per bin and partition, scaled by FFTOverhead for the
+		// memory traffic and bookkeeping the flop count misses.
+		static float GetDirectCost(const int32 InNumTaps);
+		static float GetPartitionedCost(const int32 InNumTaps, const int32 InPartitionSize);
+		static int32 GetPartitionSize(const int32 InBlockSize);
+		static EFIRMethod ChooseMethod(const int32 InNumTaps, const int32 InBlockSize);
+
+	private:
+		void InitDirect(const float* InTaps, const int32 InBlockSize);
+		void InitPartitioned(const float* InTaps, const int32 InBlockSize);
+
+		void ProcessDirect(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+		void ProcessPartitioned(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+		void ProcessPartition();
+
+		EFIRMethod mMethod = EFIRMethod::Direct;
+		int32 mNumTaps = 0;
+		int32 mLatency = 0;
+
+		// Direct: taps reversed for ConvolveValid, and NumTaps - 1 samples of history followed by the block
+		TArray<float> mReversedTaps;
+		TArray<float> mHistory;
+
+		// Partitioned
+		int32 mPartitionSize = 0;
+		int32 mNumPartitions = 0;
+		int32 mSpectrumStride = 0;		// floats per spectrum, padded to a multiple of 4
+		int32 mInputSpectrumIndex = 0;	// newest slot of the frequency domain delay line
+		int32 mPartitionFill = 0;
+
+		TUniquePtr<Audio::IFFTAlgorithm> mFFT;
+		TArray<float> mFilterSpectra;	// one scaled spectrum per partition of the taps
+		TArray<float> mInputSpectra;	// frequency domain delay line, ring of mNumPartitions spectra
+		TArray<float> mAccumulator;
+		TArray<float> mFFTInput;		// previous partition followed by the one being filled
+		TArray<float> mFFTOutput;		// the last mPartitionSize samples are the newest output
+	};
+
+} // namespace DSPProcessing
@@ -5,8 +5,11 @@
 
 #include "CoreMinimal.h"
 
+#include "AudioUtils.h"
+
 #include "MetasoundBuilderInterface.h"
 #include "MetasoundDataReferenceCollection.h"
+#include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundFacade.h"
 #include "MetasoundNode.h"
@@ -19,6 +22,8 @@
 
 namespace Metasound
 {
+	DECLARE_METASOUND_ENUM(DSPProcessing::EClickShape, DSPProcessing::EClickShape::Impulse, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumClickShape, FEnumClickShapeInfo, FEnumClickShapeReadRef, FEnumClickShapeWriteRef);
 
 	class FClickNodeOperator : public TExecutableOperator<FClickNodeOperator>
 	{
@@ -27,17 +32,22 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FClickNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn);
+		FClickNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn, const FEnumClickShapeReadRef& InShape, const FInt32ReadRef& InWidth);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
 
 		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
 
 	private:
 		float SampleRate;
 		FTriggerReadRef TriggerIn;
+		FEnumClickShapeReadRef mShape;
+		FInt32ReadRef mWidth;
 		FAudioBufferWriteRef AudioOutput;
+
+		DSPProcessing::FClick mClick;
 	};
 
 	class METASOUNDSAUDIOMATHUTILS_API FClickNode : public FNodeFacade
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -44,12 +45,54 @@ public:
 	virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
 
 	void Execute();
+	void Reset(const IOperator::FResetParams& InParams);
+
+	static void Compare(const EAudioComparisonType InComparisonType, const float* InBuffer, const float* InComparator, float* OutBuffer, const int32 InNumSamples);
 
 private:
 	FAudioBufferReadRef	 AudioInput;
 	FAudioBufferWriteRef AudioOutput;
 	FAudioBufferReadRef	 mInCompareComparator;
 	FEnumAudioCompareTypeReadRef mComparisonType;
+
+	DSPProcessing::FInputBlockCache InputCache;
+	DSPProcessing::FInputBlockCache ComparatorCache;
+	EAudioComparisonType mPreviousComparisonType = EAudioComparisonType::Equals;
+};
+
+//------------------------------------------------------------------------------------
+// TMultichannelCompareOperator
+//------------------------------------------------------------------------------------
+// One input and output per channel, with the comparator and type shared by all channels (see
+// MetasoundMultichannelAudioMathOperator.h).
+template<int32 NumChannels>
+class TMultichannelCompareOperator : public TExecutableOperator<TMultichannelCompareOperator<NumChannels>>
+{
+public:
+	static const FNodeClassMetadata& GetNodeInfo();
+	static const FVertexInterface& GetVertexInterface();
+	static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+	TMultichannelCompareOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FAudioBufferReadRef& InCompareComparator, const FEnumAudioCompareTypeReadRef& InComparisonType);
+
+	virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+	virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+	void Execute();
+	void Reset(const IOperator::FResetParams& InParams);
+
+private:
+	static FVertexName GetInputName(const int32 InChannel);
+	static FVertexName GetOutputName(const int32 InChannel);
+
+	TArray<FAudioBufferReadRef> AudioInputs;
+	TArray<FAudioBufferWriteRef> AudioOutputs;
+	FAudioBufferReadRef	 mInCompareComparator;
+	FEnumAudioCompareTypeReadRef mComparisonType;
+
+	DSPProcessing::FInputBlockCache InputCaches[NumChannels];
+	DSPProcessing::FInputBlockCache ComparatorCache;
+	EAudioComparisonType mPreviousComparisonType = EAudioComparisonType::Equals;
 };
 
 //------------------------------------------------------------------------------------
@@ -65,4 +108,7 @@ public:
 
 	}
 };
+
+using FCompareStereoNode = TAudioMathNode<TMultichannelCompareOperator<2>>;
+using FCompareQuadNode = TAudioMathNode<TMultichannelCompareOperator<4>>;
 }
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,30 +14,24 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FAudioDivideOperator
 	//------------------------------------------------------------------------------------
-	class FAudioDivideOperator : public TExecutableOperator<FAudioDivideOperator>
+	struct FAudioDivideNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FAudioDivide;
+		static constexpr bool bIsStateless = false;
+		static constexpr bool bHasAntiAliasing = false;
+		static constexpr const TCHAR* NodeName = TEXT("AudioDivide (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FAudioDivideOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InAudioDivide);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		FAudioBufferReadRef	 mInAudioDivide;
-
-		DSPProcessing::FAudioDivide AudioDivideDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOperandName();
+		static FVertexName GetOutputName();
 	};
 
+	using FAudioDivideOperator = TBinaryAudioMathOperator<FAudioDivideNodeOp>;
+	using FAudioDivideStereoNode = TAudioMathNode<TMultichannelBinaryAudioMathOperator<FAudioDivideNodeOp, 2>>;
+	using FAudioDivideQuadNode = TAudioMathNode<TMultichannelBinaryAudioMathOperator<FAudioDivideNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FAudioDivideNode
 	//------------------------------------------------------------------------------------
@@ -50,4 +46,3 @@ namespace Metasound
 		}
 	};
 }
-
@@ -0,0 +1,394 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "AudioUtils.h"
+#include "Oversampler.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+namespace Metasound
+{
+	DECLARE_METASOUND_ENUM(DSPProcessing::EAntiAliasing, DSPProcessing::EAntiAliasing::None, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumAntiAliasing, FEnumAntiAliasingInfo, FEnumAntiAliasingReadRef, FEnumAntiAliasingWriteRef);
+
+	// Operators for the stateless element-wise math nodes.
+	//
+	// Each node declares an Op struct (F<Name>NodeOp, not to be confused with the DSPProcessing::F<Name>Op kernels)
+	// holding its DSP processor and vertices, defined in the node's cpp:
+	//   using FProcessor = DSPProcessing::FSine;
+	//   static constexpr bool bIsStateless = true;             // recompute only when an input block changes, for ops
+	//                                                          // costing more than the compare and copy of each input
+	//   static constexpr bool bHasAntiAliasing = false;        // nonlinear ops: adds an FEnumAntiAliasing input and a Latency output
+	//   static constexpr const TCHAR* NodeName = TEXT("...");  // profiler scope and log messages
+	//   static const FNodeClassMetadata& GetNodeInfo();
+	//   static const FVertexInterface& GetVertexInterface();
+	//   static FVertexName GetInputName();
+	//   static FVertexName GetOperandName();                   // binary ops only
+	//   static FVertexName GetOutputName();
+	//   static FVertexName GetAntiAliasingName();              // bHasAntiAliasing ops only
+	//   static FVertexName GetLatencyName();                   // bHasAntiAliasing ops only
+	//
+	// The operators add the unchanged-input cache, non-finite checks, profiling and Reset once for every node.
+	// Oversampling wraps only the Op's processor, so the rest of the graph stays at the base rate. The Antiderivative
+	// mode calls the processor's ProcessAntiderivative instead, which anti-aliasing ops must provide.
+
+	//------------------------------------------------------------------------------------
+	// TUnaryAudioMathOperator
+	//------------------------------------------------------------------------------------
+	template<typename Op>
+	class TUnaryAudioMathOperator : public TExecutableOperator<TUnaryAudioMathOperator<Op>>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			return Op::GetNodeInfo();
+		}
+
+		static const FVertexInterface& GetVertexInterface()
+		{
+			return Op::GetVertexInterface();
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+		{
+			const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+			FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(Op::GetInputName(), InParams.OperatorSettings);
+
+			FEnumAntiAliasingReadRef AntiAliasing = FEnumAntiAliasingReadRef::CreateNew();
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				AntiAliasing = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumAntiAliasing>(GetVertexInterface().GetInputInterface(), Op::GetAntiAliasingName(), InParams.OperatorSettings);
+			}
+
+			return MakeUnique<TUnaryAudioMathOperator<Op>>(InParams.OperatorSettings, AudioIn, AntiAliasing);
+		}
+
+		TUnaryAudioMathOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAntiAliasingReadRef& InAntiAliasing)
+			: AudioInput(InAudioInput)
+			, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+			, mAntiAliasing(InAntiAliasing)
+			, mLatency(FTimeWriteRef::CreateNew())
+			, SampleRate(InSettings.GetSampleRate())
+		{
+			if constexpr (Op::bIsStateless)
+			{
+				InputCache.Init(InSettings.GetNumFramesPerBlock());
+			}
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				Oversampler.Init(InSettings.GetNumFramesPerBlock());
+				UpdateAntiAliasing();
+			}
+		}
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			InOutVertexData.BindReadVertex(Op::GetInputName(), AudioInput);
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				InOutVertexData.BindReadVertex(Op::GetAntiAliasingName(), mAntiAliasing);
+			}
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			InOutVertexData.BindReadVertex(Op::GetOutputName(), AudioOutput);
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				InOutVertexData.BindReadVertex(Op::GetLatencyName(), mLatency);
+			}
+		}
+
+		void Execute()
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_STR(Op::NodeName);
+
+			const float* InputAudio = AudioInput->GetData();
+			float* OutputAudio = AudioOutput->GetData();
+
+			const int32 NumSamples = AudioInput->Num();
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				UpdateAntiAliasing();
+
+				if (mCurrentAntiAliasing == DSPProcessing::EAntiAliasing::Antiderivative)
+				{
+					DSPProcessor.ProcessAntiderivative(InputAudio, OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+					if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, Op::NodeName))
+					{
+						DSPProcessor = typename Op::FProcessor();
+					}
+#endif
+					return;
+				}
+
+				if (Oversampler.GetFactor() > 1)
+				{
+					float* Oversampled = Oversampler.Upsample(InputAudio, NumSamples);
+					DSPProcessor.ProcessAudioBuffer(Oversampled, Oversampled, Oversampler.GetNumOversampledSamples(NumSamples));
+					Oversampler.Downsample(OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+					if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, Op::NodeName))
+					{
+						Oversampler.Reset();
+					}
+#endif
+					return;
+				}
+			}
+
+			// the output still holds the result for this exact input, nothing to recompute
+			if constexpr (Op::bIsStateless)
+			{
+				if (InputCache.MatchesPrevious(InputAudio, NumSamples))
+				{
+					return;
+				}
+			}
+
+			DSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+			DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, Op::NodeName);
+#endif
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			AudioOutput->Zero();
+			DSPProcessor = typename Op::FProcessor();
+			InputCache.Invalidate();
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				Oversampler.Reset();
+			}
+		}
+
+	private:
+		// Follows the Anti-Aliasing input. Only filter state is cleared on a change, nothing is allocated.
+		void UpdateAntiAliasing()
+		{
+			const DSPProcessing::EAntiAliasing AntiAliasing = *mAntiAliasing;
+			if (AntiAliasing != mCurrentAntiAliasing)
+			{
+				mCurrentAntiAliasing = AntiAliasing;
+				Oversampler.SetFactor(DSPProcessing::GetOversamplingFactor(AntiAliasing));
+				DSPProcessor = typename Op::FProcessor();
+				InputCache.Invalidate();
+
+				const float LatencyInSamples = AntiAliasing == DSPProcessing::EAntiAliasing::Antiderivative ? 0.5f : Oversampler.GetLatencyInSamples();
+				*mLatency = FTime(LatencyInSamples / SampleRate);
+			}
+		}
+
+		FAudioBufferReadRef	 AudioInput;
+		FAudioBufferWriteRef AudioOutput;
+
+		FEnumAntiAliasingReadRef mAntiAliasing;
+		DSPProcessing::EAntiAliasing mCurrentAntiAliasing = DSPProcessing::EAntiAliasing::None;
+		FTimeWriteRef mLatency;
+		float SampleRate;
+
+		typename Op::FProcessor DSPProcessor;
+		DSPProcessing::FInputBlockCache InputCache;
+		DSPProcessing::FOversampler Oversampler;
+	};
+
+	//------------------------------------------------------------------------------------
+	// TBinaryAudioMathOperator
+	//------------------------------------------------------------------------------------
+	template<typename Op>
+	class TBinaryAudioMathOperator : public TExecutableOperator<TBinaryAudioMathOperator<Op>>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			return Op::GetNodeInfo();
+		}
+
+		static const FVertexInterface& GetVertexInterface()
+		{
+			return Op::GetVertexInterface();
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+		{
+			const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+			FAudioBufferReadRef AudioIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(Op::GetInputName(), InParams.OperatorSettings);
+			FAudioBufferReadRef OperandIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(Op::GetOperandName(), InParams.OperatorSettings);
+
+			FEnumAntiAliasingReadRef AntiAliasing = FEnumAntiAliasingReadRef::CreateNew();
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				AntiAliasing = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumAntiAliasing>(GetVertexInterface().GetInputInterface(), Op::GetAntiAliasingName(), InParams.OperatorSettings);
+			}
+
+			return MakeUnique<TBinaryAudioMathOperator<Op>>(InParams.OperatorSettings, AudioIn, OperandIn, AntiAliasing);
+		}
+
+		TBinaryAudioMathOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InOperand, const FEnumAntiAliasingReadRef& InAntiAliasing)
+			: AudioInput(InAudioInput)
+			, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+			, mInOperand(InOperand)
+			, mAntiAliasing(InAntiAliasing)
+			, mLatency(FTimeWriteRef::CreateNew())
+			, SampleRate(InSettings.GetSampleRate())
+		{
+			if constexpr (Op::bIsStateless)
+			{
+				InputCache.Init(InSettings.GetNumFramesPerBlock());
+				OperandCache.Init(InSettings.GetNumFramesPerBlock());
+			}
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				Oversampler.Init(InSettings.GetNumFramesPerBlock());
+				UpdateAntiAliasing();
+			}
+		}
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			InOutVertexData.BindReadVertex(Op::GetInputName(), AudioInput);
+			InOutVertexData.BindReadVertex(Op::GetOperandName(), mInOperand);
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				InOutVertexData.BindReadVertex(Op::GetAntiAliasingName(), mAntiAliasing);
+			}
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			InOutVertexData.BindReadVertex(Op::GetOutputName(), AudioOutput);
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				InOutVertexData.BindReadVertex(Op::GetLatencyName(), mLatency);
+			}
+		}
+
+		void Execute()
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_STR(Op::NodeName);
+
+			const float* InputAudio = AudioInput->GetData();
+			float* OutputAudio = AudioOutput->GetData();
+			const float* InputOperand = mInOperand->GetData();
+
+			const int32 NumSamples = AudioInput->Num();
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				UpdateAntiAliasing();
+
+				if (mCurrentAntiAliasing == DSPProcessing::EAntiAliasing::Antiderivative)
+				{
+					DSPProcessor.ProcessAntiderivative(InputAudio, OutputAudio, InputOperand, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+					if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, Op::NodeName))
+					{
+						DSPProcessor = typename Op::FProcessor();
+					}
+#endif
+					return;
+				}
+
+				if (Oversampler.GetFactor() > 1)
+				{
+					// the operand is held rather than interpolated, it shapes the curve rather than being the signal
+					const float* HeldOperand = Oversampler.HoldOperand(InputOperand, NumSamples);
+					float* Oversampled = Oversampler.Upsample(InputAudio, NumSamples);
+					DSPProcessor.ProcessAudioBuffer(Oversampled, Oversampled, HeldOperand, Oversampler.GetNumOversampledSamples(NumSamples));
+					Oversampler.Downsample(OutputAudio, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+					if (DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, Op::NodeName))
+					{
+						Oversampler.Reset();
+					}
+#endif
+					return;
+				}
+			}
+
+			if constexpr (Op::bIsStateless)
+			{
+				// evaluate both so each cache always holds the latest block
+				const bool bInputMatches = InputCache.MatchesPrevious(InputAudio, NumSamples);
+				const bool bOperandMatches = OperandCache.MatchesPrevious(InputOperand, NumSamples);
+				if (bInputMatches && bOperandMatches)
+				{
+					return;
+				}
+			}
+
+			DSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputOperand, NumSamples);
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+			DSPProcessing::SanitizeNonFinite(OutputAudio, NumSamples, Op::NodeName);
+#endif
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			AudioOutput->Zero();
+			DSPProcessor = typename Op::FProcessor();
+			InputCache.Invalidate();
+			OperandCache.Invalidate();
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				Oversampler.Reset();
+			}
+		}
+
+	private:
+		void UpdateAntiAliasing()
+		{
+			const DSPProcessing::EAntiAliasing AntiAliasing = *mAntiAliasing;
+			if (AntiAliasing != mCurrentAntiAliasing)
+			{
+				mCurrentAntiAliasing = AntiAliasing;
+				Oversampler.SetFactor(DSPProcessing::GetOversamplingFactor(AntiAliasing));
+				DSPProcessor = typename Op::FProcessor();
+				InputCache.Invalidate();
+				OperandCache.Invalidate();
+
+				const float LatencyInSamples = AntiAliasing == DSPProcessing::EAntiAliasing::Antiderivative ? 0.5f : Oversampler.GetLatencyInSamples();
+				*mLatency = FTime(LatencyInSamples / SampleRate);
+			}
+		}
+
+		FAudioBufferReadRef	 AudioInput;
+		FAudioBufferWriteRef AudioOutput;
+
+		FAudioBufferReadRef	 mInOperand;
+
+		FEnumAntiAliasingReadRef mAntiAliasing;
+		DSPProcessing::EAntiAliasing mCurrentAntiAliasing = DSPProcessing::EAntiAliasing::None;
+		FTimeWriteRef mLatency;
+		float SampleRate;
+
+		typename Op::FProcessor DSPProcessor;
+		DSPProcessing::FInputBlockCache InputCache;
+		DSPProcessing::FInputBlockCache OperandCache;
+		DSPProcessing::FOversampler Oversampler;
+	};
+}
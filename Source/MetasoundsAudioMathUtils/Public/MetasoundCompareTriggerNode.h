@@ -0,0 +1,59 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioUtils.h"
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundTrigger.h"
+
+
+namespace Metasound
+{
+
+	class FCompareTriggerOperator : public TExecutableOperator<FCompareTriggerOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FCompareTriggerOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FFloatReadRef& InThreshold, const FFloatReadRef& InHysteresis);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		FAudioBufferReadRef AudioInput;
+		FFloatReadRef mThreshold;
+		FFloatReadRef mHysteresis;
+		FTriggerWriteRef mOnRise;
+		FTriggerWriteRef mOnFall;
+
+		DSPProcessing::FSchmittTrigger mSchmittTrigger;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FCompareTriggerNode : public FNodeFacade
+	{
+	public:
+		FCompareTriggerNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FCompareTriggerOperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,28 +14,23 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FCosOperator
 	//------------------------------------------------------------------------------------
-	class FCosOperator : public TExecutableOperator<FCosOperator>
+	struct FCosNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FCos;
+		static constexpr bool bIsStateless = true;
+		static constexpr bool bHasAntiAliasing = false;
+		static constexpr const TCHAR* NodeName = TEXT("Cos (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FCosOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		DSPProcessing::FCos CosDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOutputName();
 	};
 
+	using FCosOperator = TUnaryAudioMathOperator<FCosNodeOp>;
+	using FCosStereoNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FCosNodeOp, 2>>;
+	using FCosQuadNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FCosNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FCosNode
 	//------------------------------------------------------------------------------------
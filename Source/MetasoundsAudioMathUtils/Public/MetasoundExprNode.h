@@ -0,0 +1,56 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "AudioExpression.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+
+namespace Metasound
+{
+	//------------------------------------------------------------------------------------
+	// FExprOperator
+	//------------------------------------------------------------------------------------
+	class FExprOperator : public TExecutableOperator<FExprOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FExprOperator(const FOperatorSettings& InSettings, const FStringReadRef& InExpression, const FAudioBufferReadRef& InX, const FAudioBufferReadRef& InY, const FAudioBufferReadRef& InZ, const FAudioBufferReadRef& InW);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		FStringReadRef		 mExpression;
+		FAudioBufferReadRef	 mInX;
+		FAudioBufferReadRef	 mInY;
+		FAudioBufferReadRef	 mInZ;
+		FAudioBufferReadRef	 mInW;
+		FAudioBufferWriteRef AudioOutput;
+
+		// compiled once when the operator is built
+		DSPProcessing::FAudioExpression Expression;
+	};
+
+	//------------------------------------------------------------------------------------
+	// FExprNode
+	//------------------------------------------------------------------------------------
+	class METASOUNDSAUDIOMATHUTILS_API FExprNode : public FNodeFacade
+	{
+	public:
+		// Constructor used by the Metasound Frontend.
+		FExprNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FExprOperator>())
+		{
+
+		}
+	};
+}
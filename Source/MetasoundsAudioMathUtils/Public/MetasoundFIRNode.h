@@ -0,0 +1,76 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioUtils.h"
+#include "CoefficientDesigner.h"
+#include "FIRConvolver.h"
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundTime.h"
+
+
+namespace Metasound
+{
+
+	class FFIROperator : public TExecutableOperator<FFIROperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		// longer impulse responses are truncated, so the tap buffers below can be reserved up front
+		static constexpr int32 MaxTaps = 4096;
+
+		FFIROperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const TDataReadReference<TArray<float>>& InTaps);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		void UpdateTaps();
+		void UpdateLatency();
+		TArrayView<const float> GetTaps() const;
+
+		static void InitConvolver(DSPProcessing::FFIRConvolver& OutConvolver, const TArray<float>& InTaps, const int32 InBlockSize);
+
+		FAudioBufferReadRef AudioInput;
+		TDataReadReference<TArray<float>> mTaps;
+		FAudioBufferWriteRef AudioOutput;
+		FTimeWriteRef mLatency;
+
+		int32 BlockSize = 0;
+		float SampleRate = 0.0f;
+
+		// the taps the newest convolver was requested with
+		TArray<float> mRequestedTaps;
+
+		// convolvers for new taps are built off the audio thread, the current one is always valid
+		DSPProcessing::TAsyncCoefficientDesigner<DSPProcessing::FFIRConvolver, TArray<float>> mConvolverDesigner;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FFIRNode : public FNodeFacade
+	{
+	public:
+		FFIRNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FFIROperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
@@ -0,0 +1,56 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "AudioExpression.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+
+namespace Metasound
+{
+	//------------------------------------------------------------------------------------
+	// FFeedbackExprOperator
+	//------------------------------------------------------------------------------------
+	class FFeedbackExprOperator : public TExecutableOperator<FFeedbackExprOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FFeedbackExprOperator(const FOperatorSettings& InSettings, const FStringReadRef& InExpression, const FAudioBufferReadRef& InX, const FAudioBufferReadRef& InY, const FAudioBufferReadRef& InZ, const FAudioBufferReadRef& InW);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		FStringReadRef		 mExpression;
+		FAudioBufferReadRef	 mInX;
+		FAudioBufferReadRef	 mInY;
+		FAudioBufferReadRef	 mInZ;
+		FAudioBufferReadRef	 mInW;
+		FAudioBufferWriteRef AudioOutput;
+
+		// compiled once when the operator is built, holds the z^-1 state between blocks
+		DSPProcessing::FAudioExpression Expression;
+	};
+
+	//------------------------------------------------------------------------------------
+	// FFeedbackExprNode
+	//------------------------------------------------------------------------------------
+	class METASOUNDSAUDIOMATHUTILS_API FFeedbackExprNode : public FNodeFacade
+	{
+	public:
+		// Constructor used by the Metasound Frontend.
+		FFeedbackExprNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FFeedbackExprOperator>())
+		{
+
+		}
+	};
+}
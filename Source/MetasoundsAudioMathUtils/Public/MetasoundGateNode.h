@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,30 +14,24 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FGateOperator
 	//------------------------------------------------------------------------------------
-	class FGateOperator : public TExecutableOperator<FGateOperator>
+	struct FGateNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FGate;
+		static constexpr bool bIsStateless = false;
+		static constexpr bool bHasAntiAliasing = false;
+		static constexpr const TCHAR* NodeName = TEXT("Gate (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FGateOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InGateToggle);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		FAudioBufferReadRef	 mInGateToggle;
-
-		DSPProcessing::FGate GateDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOperandName();
+		static FVertexName GetOutputName();
 	};
 
+	using FGateOperator = TBinaryAudioMathOperator<FGateNodeOp>;
+	using FGateStereoNode = TAudioMathNode<TMultichannelBinaryAudioMathOperator<FGateNodeOp, 2>>;
+	using FGateQuadNode = TAudioMathNode<TMultichannelBinaryAudioMathOperator<FGateNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FGateNode
 	//------------------------------------------------------------------------------------
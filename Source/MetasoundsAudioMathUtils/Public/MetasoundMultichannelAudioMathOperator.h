@@ -0,0 +1,354 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundVertex.h"
+
+namespace Metasound
+{
+	namespace MultichannelAudioMath
+	{
+		// Channel layouts the multichannel nodes are registered for.
+		constexpr int32 MaxChannels = 4;
+
+		// Channels are processed in turn over chunks of this many frames, so a shared operand chunk is still in cache
+		// for every channel after the first. A multiple of 4 to keep each chunk 16 byte aligned.
+		constexpr int32 ChunkSize = 64;
+
+		// "L"/"R" for stereo, "FL"/"FR"/"BL"/"BR" for quad, otherwise the channel index
+		METASOUNDSAUDIOMATHUTILS_API FString GetChannelName(const int32 InNumChannels, const int32 InChannel);
+
+		// e.g. "In" becomes "In L"
+		METASOUNDSAUDIOMATHUTILS_API FVertexName MakeChannelVertexName(const FVertexName& InMonoName, const int32 InNumChannels, const int32 InChannel);
+
+		// The mono interface with InMonoInputName and InMonoOutputName split into one audio vertex per channel, in
+		// the same place and with the same tooltip. Every other vertex is shared by all channels and kept as is.
+		METASOUNDSAUDIOMATHUTILS_API FVertexInterface MakeVertexInterface(const FVertexInterface& InMonoInterface, const FVertexName& InMonoInputName, const FVertexName& InMonoOutputName, const int32 InNumChannels);
+
+		// The mono node's metadata with the channel layout as class variant and display name prefix, e.g.
+		// "Stereo Pow (Audio)".
+		METASOUNDSAUDIOMATHUTILS_API FNodeClassMetadata MakeNodeInfo(const FNodeClassMetadata& InMonoInfo, const int32 InNumChannels, const FVertexInterface& InInterface);
+	}
+
+	// Multichannel versions of the element-wise math operators, taking the same Op structs (see
+	// MetasoundAudioMathOperator.h). Every channel gets its own input, output and processor, while the operand,
+	// Anti-Aliasing mode and Latency are shared by all channels and keep the mono node's vertices.
+	//
+	// One operator replaces NumChannels mono nodes: one dispatch, one operand cache and one anti-aliasing watcher
+	// per block, and the shared operand is read once per chunk instead of once per node.
+	template<typename Op, int32 NumChannels, bool bHasOperand>
+	class TMultichannelAudioMathOperator : public TExecutableOperator<TMultichannelAudioMathOperator<Op, NumChannels, bHasOperand>>
+	{
+		static_assert(NumChannels > 1 && NumChannels <= MultichannelAudioMath::MaxChannels, "Unsupported channel count");
+
+	public:
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			static const FNodeClassMetadata Info = MultichannelAudioMath::MakeNodeInfo(Op::GetNodeInfo(), NumChannels, GetVertexInterface());
+			return Info;
+		}
+
+		static const FVertexInterface& GetVertexInterface()
+		{
+			static const FVertexInterface Interface = MultichannelAudioMath::MakeVertexInterface(Op::GetVertexInterface(), Op::GetInputName(), Op::GetOutputName(), NumChannels);
+			return Interface;
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+		{
+			const FDataReferenceCollection& InputCollection = InParams.InputData.ToDataReferenceCollection();
+
+			TArray<FAudioBufferReadRef> AudioIns;
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				AudioIns.Add(InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(GetInputName(Channel), InParams.OperatorSettings));
+			}
+
+			FAudioBufferReadRef OperandIn = FAudioBufferReadRef::CreateNew(InParams.OperatorSettings);
+			if constexpr (bHasOperand)
+			{
+				OperandIn = InputCollection.GetDataReadReferenceOrConstruct<FAudioBuffer>(Op::GetOperandName(), InParams.OperatorSettings);
+			}
+
+			FEnumAntiAliasingReadRef AntiAliasing = FEnumAntiAliasingReadRef::CreateNew();
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				AntiAliasing = InputCollection.GetDataReadReferenceOrConstructWithVertexDefault<FEnumAntiAliasing>(GetVertexInterface().GetInputInterface(), Op::GetAntiAliasingName(), InParams.OperatorSettings);
+			}
+
+			return MakeUnique<TMultichannelAudioMathOperator<Op, NumChannels, bHasOperand>>(InParams.OperatorSettings, AudioIns, OperandIn, AntiAliasing);
+		}
+
+		TMultichannelAudioMathOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FAudioBufferReadRef& InOperand, const FEnumAntiAliasingReadRef& InAntiAliasing)
+			: AudioInputs(InAudioInputs)
+			, mInOperand(InOperand)
+			, mAntiAliasing(InAntiAliasing)
+			, mLatency(FTimeWriteRef::CreateNew())
+			, SampleRate(InSettings.GetSampleRate())
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				AudioOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+			}
+
+			if constexpr (Op::bIsStateless)
+			{
+				for (DSPProcessing::FInputBlockCache& InputCache : InputCaches)
+				{
+					InputCache.Init(InSettings.GetNumFramesPerBlock());
+				}
+
+				if constexpr (bHasOperand)
+				{
+					OperandCache.Init(InSettings.GetNumFramesPerBlock());
+				}
+			}
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				for (DSPProcessing::FOversampler& Oversampler : Oversamplers)
+				{
+					Oversampler.Init(MultichannelAudioMath::ChunkSize);
+				}
+
+				UpdateAntiAliasing();
+			}
+		}
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				InOutVertexData.BindReadVertex(GetInputName(Channel), AudioInputs[Channel]);
+			}
+
+			if constexpr (bHasOperand)
+			{
+				InOutVertexData.BindReadVertex(Op::GetOperandName(), mInOperand);
+			}
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				InOutVertexData.BindReadVertex(Op::GetAntiAliasingName(), mAntiAliasing);
+			}
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				InOutVertexData.BindReadVertex(GetOutputName(Channel), AudioOutputs[Channel]);
+			}
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				InOutVertexData.BindReadVertex(Op::GetLatencyName(), mLatency);
+			}
+		}
+
+		void Execute()
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_STR(Op::NodeName);
+
+			const float* InputOperand = mInOperand->GetData();
+			const int32 NumSamples = AudioInputs[0]->Num();
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				UpdateAntiAliasing();
+			}
+
+			bool bProcessChannel[NumChannels];
+			for (bool& bProcess : bProcessChannel)
+			{
+				bProcess = true;
+			}
+
+			// as in the mono operators, only the plain path is stateless
+			if constexpr (Op::bIsStateless)
+			{
+				if (mCurrentAntiAliasing == DSPProcessing::EAntiAliasing::None)
+				{
+					// evaluate every cache so each always holds the latest block
+					bool bOperandMatches = true;
+					if constexpr (bHasOperand)
+					{
+						bOperandMatches = OperandCache.MatchesPrevious(InputOperand, NumSamples);
+					}
+
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						const bool bInputMatches = InputCaches[Channel].MatchesPrevious(AudioInputs[Channel]->GetData(), NumSamples);
+						bProcessChannel[Channel] = !(bInputMatches && bOperandMatches);
+					}
+				}
+			}
+
+			for (int32 Offset = 0; Offset < NumSamples; Offset += MultichannelAudioMath::ChunkSize)
+			{
+				const int32 NumChunkSamples = FMath::Min(MultichannelAudioMath::ChunkSize, NumSamples - Offset);
+				const float* OperandChunk = &InputOperand[Offset];
+
+				// oversampled binary ops hold the shared operand once per chunk, in the first channel's oversampler
+				const float* HeldOperand = OperandChunk;
+				if constexpr (Op::bHasAntiAliasing && bHasOperand)
+				{
+					if (Oversamplers[0].GetFactor() > 1 && mCurrentAntiAliasing != DSPProcessing::EAntiAliasing::Antiderivative)
+					{
+						HeldOperand = Oversamplers[0].HoldOperand(OperandChunk, NumChunkSamples);
+					}
+				}
+
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					if (bProcessChannel[Channel])
+					{
+						ProcessChunk(Channel, &AudioInputs[Channel]->GetData()[Offset], &AudioOutputs[Channel]->GetData()[Offset], OperandChunk, HeldOperand, NumChunkSamples);
+					}
+				}
+			}
+
+#if AUDIOMATHUTILS_NONFINITE_CHECKS
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				if (bProcessChannel[Channel] && DSPProcessing::SanitizeNonFinite(AudioOutputs[Channel]->GetData(), NumSamples, Op::NodeName))
+				{
+					DSPProcessors[Channel] = typename Op::FProcessor();
+					Oversamplers[Channel].Reset();
+				}
+			}
+#endif
+		}
+
+		void Reset(const IOperator::FResetParams& InParams)
+		{
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				AudioOutputs[Channel]->Zero();
+				DSPProcessors[Channel] = typename Op::FProcessor();
+				InputCaches[Channel].Invalidate();
+
+				if constexpr (Op::bHasAntiAliasing)
+				{
+					Oversamplers[Channel].Reset();
+				}
+			}
+
+			OperandCache.Invalidate();
+		}
+
+	private:
+		static FVertexName GetInputName(const int32 InChannel)
+		{
+			return MultichannelAudioMath::MakeChannelVertexName(Op::GetInputName(), NumChannels, InChannel);
+		}
+
+		static FVertexName GetOutputName(const int32 InChannel)
+		{
+			return MultichannelAudioMath::MakeChannelVertexName(Op::GetOutputName(), NumChannels, InChannel);
+		}
+
+		void ProcessChunk(const int32 InChannel, const float* InBuffer, float* OutBuffer, const float* InOperand, const float* InHeldOperand, const int32 InNumSamples)
+		{
+			typename Op::FProcessor& DSPProcessor = DSPProcessors[InChannel];
+
+			if constexpr (Op::bHasAntiAliasing)
+			{
+				if (mCurrentAntiAliasing == DSPProcessing::EAntiAliasing::Antiderivative)
+				{
+					if constexpr (bHasOperand)
+					{
+						DSPProcessor.ProcessAntiderivative(InBuffer, OutBuffer, InOperand, InNumSamples);
+					}
+					else
+					{
+						DSPProcessor.ProcessAntiderivative(InBuffer, OutBuffer, InNumSamples);
+					}
+					return;
+				}
+
+				DSPProcessing::FOversampler& Oversampler = Oversamplers[InChannel];
+				if (Oversampler.GetFactor() > 1)
+				{
+					float* Oversampled = Oversampler.Upsample(InBuffer, InNumSamples);
+					if constexpr (bHasOperand)
+					{
+						DSPProcessor.ProcessAudioBuffer(Oversampled, Oversampled, InHeldOperand, Oversampler.GetNumOversampledSamples(InNumSamples));
+					}
+					else
+					{
+						DSPProcessor.ProcessAudioBuffer(Oversampled, Oversampled, Oversampler.GetNumOversampledSamples(InNumSamples));
+					}
+					Oversampler.Downsample(OutBuffer, InNumSamples);
+					return;
+				}
+			}
+
+			if constexpr (bHasOperand)
+			{
+				DSPProcessor.ProcessAudioBuffer(InBuffer, OutBuffer, InOperand, InNumSamples);
+			}
+			else
+			{
+				DSPProcessor.ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+			}
+		}
+
+		void UpdateAntiAliasing()
+		{
+			const DSPProcessing::EAntiAliasing AntiAliasing = *mAntiAliasing;
+			if (AntiAliasing != mCurrentAntiAliasing)
+			{
+				mCurrentAntiAliasing = AntiAliasing;
+
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					Oversamplers[Channel].SetFactor(DSPProcessing::GetOversamplingFactor(AntiAliasing));
+					DSPProcessors[Channel] = typename Op::FProcessor();
+					InputCaches[Channel].Invalidate();
+				}
+
+				OperandCache.Invalidate();
+
+				const float LatencyInSamples = AntiAliasing == DSPProcessing::EAntiAliasing::Antiderivative ? 0.5f : Oversamplers[0].GetLatencyInSamples();
+				*mLatency = FTime(LatencyInSamples / SampleRate);
+			}
+		}
+
+		TArray<FAudioBufferReadRef> AudioInputs;
+		TArray<FAudioBufferWriteRef> AudioOutputs;
+
+		FAudioBufferReadRef mInOperand;
+
+		FEnumAntiAliasingReadRef mAntiAliasing;
+		DSPProcessing::EAntiAliasing mCurrentAntiAliasing = DSPProcessing::EAntiAliasing::None;
+		FTimeWriteRef mLatency;
+		float SampleRate;
+
+		typename Op::FProcessor DSPProcessors[NumChannels];
+		DSPProcessing::FInputBlockCache InputCaches[NumChannels];
+		DSPProcessing::FInputBlockCache OperandCache;
+		DSPProcessing::FOversampler Oversamplers[NumChannels];
+	};
+
+	template<typename Op, int32 NumChannels>
+	using TMultichannelUnaryAudioMathOperator = TMultichannelAudioMathOperator<Op, NumChannels, false>;
+
+	template<typename Op, int32 NumChannels>
+	using TMultichannelBinaryAudioMathOperator = TMultichannelAudioMathOperator<Op, NumChannels, true>;
+
+	// Node class for any of the math operators, so multichannel variants need no facade class of their own.
+	template<typename OperatorType>
+	class TAudioMathNode : public FNodeFacade
+	{
+	public:
+		TAudioMathNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<OperatorType>())
+		{
+		}
+	};
+}
@@ -25,6 +25,7 @@ namespace Metasound
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
 
 		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
 
 	private:
 		FAudioBufferReadRef	 AudioInput;
@@ -0,0 +1,63 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioUtils.h"
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+
+
+namespace Metasound
+{
+
+	class FOnePoleIIRBankOperator : public TExecutableOperator<FOnePoleIIRBankOperator>
+	{
+	public:
+		static constexpr int32 NumLanes = DSPProcessing::FOnePoleIIRBank::NumLanes;
+
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FOnePoleIIRBankOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FFloatReadRef& InCoefficientA, const FFloatReadRef& InCoefficientB);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		TArray<FAudioBufferReadRef> AudioInputs;
+		FFloatReadRef mCoefficientA;
+		FFloatReadRef mCoefficientB;
+		TArray<FAudioBufferWriteRef> AudioOutputs;
+
+		// buffer pointers gathered once, the buffers themselves never move
+		const float* mInputData[NumLanes];
+		float* mOutputData[NumLanes];
+
+		DSPProcessing::FOnePoleIIRBank mBank;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FOnePoleIIRBankNode : public FNodeFacade
+	{
+	public:
+		FOnePoleIIRBankNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FOnePoleIIRBankOperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,30 +14,26 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FPowOperator
 	//------------------------------------------------------------------------------------
-	class FPowOperator : public TExecutableOperator<FPowOperator>
+	struct FPowNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FPow;
+		static constexpr bool bIsStateless = false;
+		static constexpr bool bHasAntiAliasing = true;
+		static constexpr const TCHAR* NodeName = TEXT("Pow (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FPowOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPowerOf);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		FAudioBufferReadRef	 mInPowerOf;
-
-		DSPProcessing::FPow PowDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOperandName();
+		static FVertexName GetOutputName();
+		static FVertexName GetAntiAliasingName();
+		static FVertexName GetLatencyName();
 	};
 
+	using FPowOperator = TBinaryAudioMathOperator<FPowNodeOp>;
+	using FPowStereoNode = TAudioMathNode<TMultichannelBinaryAudioMathOperator<FPowNodeOp, 2>>;
+	using FPowQuadNode = TAudioMathNode<TMultichannelBinaryAudioMathOperator<FPowNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FPowNode
 	//------------------------------------------------------------------------------------
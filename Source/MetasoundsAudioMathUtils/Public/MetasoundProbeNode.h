@@ -0,0 +1,60 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioMathEventChannels.h"
+#include "AudioUtils.h"
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+
+
+namespace Metasound
+{
+
+	class FProbeOperator : public TExecutableOperator<FProbeOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FProbeOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FString& InChannelName, const FInt32ReadRef& InDecimation);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		FAudioBufferReadRef AudioInput;
+		FInt32ReadRef mDecimation;
+
+		float SampleRate;
+		int64 mBlockStartSample;
+
+		// invalid when Channel is empty or already written by another node, the node is then a plain pass through
+		FProbeEventWriter mEventWriter;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FProbeNode : public FNodeFacade
+	{
+	public:
+		FProbeNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FProbeOperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
@@ -0,0 +1,68 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioUtils.h"
+#include "CoefficientDesigner.h"
+#include "PolyphaseResampler.h"
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+
+
+namespace Metasound
+{
+
+	class FResampleOperator : public TExecutableOperator<FResampleOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FResampleOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FFloatReadRef& InRatio, const FAudioBufferReadRef& InRatioMod);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		void UpdateCutoff(const float InMaxRatio);
+
+		FAudioBufferReadRef AudioInput;
+		FFloatReadRef mRatio;
+		FAudioBufferReadRef mRatioMod;
+		FAudioBufferWriteRef AudioOutput;
+
+		// Ratio + Ratio Mod, only filled when the modulation is not silent
+		TArray<float> mModulatedRatio;
+
+		DSPProcessing::FPolyphaseResampler mResampler;
+
+		// tables for new Ratio settings are designed off the audio thread
+		DSPProcessing::TAsyncCoefficientDesigner<DSPProcessing::FPolyphaseFilterTable, float> mTableDesigner;
+		float mRequestedCutoff = 0.0f;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FResampleNode : public FNodeFacade
+	{
+	public:
+		FResampleNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FResampleOperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
@@ -0,0 +1,69 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioUtils.h"
+
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundTrigger.h"
+
+
+namespace Metasound
+{
+	enum class ESampholdMode
+	{
+		Phasor,
+		Trigger
+	};
+
+	DECLARE_METASOUND_ENUM(ESampholdMode, ESampholdMode::Phasor, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumSampholdMode, FEnumSampholdModeInfo, FEnumSampholdModeReadRef, FEnumSampholdModeWriteRef);
+
+	class FSampholdOperator : public TExecutableOperator<FSampholdOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FSampholdOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPhasor, const FTriggerReadRef& InTrigger, const FEnumSampholdModeReadRef& InMode);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		FAudioBufferReadRef AudioInput;
+		FAudioBufferReadRef mPhasor;
+		FTriggerReadRef TriggerIn;
+		FEnumSampholdModeReadRef mMode;
+		FAudioBufferWriteRef AudioOutput;
+
+		DSPProcessing::FSamphold mSamphold;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FSampholdNode : public FNodeFacade
+	{
+	public:
+		FSampholdNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FSampholdOperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,28 +14,23 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FSineOperator
 	//------------------------------------------------------------------------------------
-	class FSineOperator : public TExecutableOperator<FSineOperator>
+	struct FSineNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FSine;
+		static constexpr bool bIsStateless = true;
+		static constexpr bool bHasAntiAliasing = false;
+		static constexpr const TCHAR* NodeName = TEXT("Sine (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FSineOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		DSPProcessing::FSine SineDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOutputName();
 	};
 
+	using FSineOperator = TUnaryAudioMathOperator<FSineNodeOp>;
+	using FSineStereoNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FSineNodeOp, 2>>;
+	using FSineQuadNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FSineNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FSineNode
 	//------------------------------------------------------------------------------------
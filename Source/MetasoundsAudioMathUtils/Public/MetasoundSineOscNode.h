@@ -0,0 +1,56 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AudioUtils.h"
+
+#include "MetasoundBuilderInterface.h"
+#include "MetasoundDataReferenceCollection.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundFacade.h"
+#include "MetasoundNode.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundParamHelper.h"
+
+
+namespace Metasound
+{
+	class FSineOscOperator : public TExecutableOperator<FSineOscOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FSineOscOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InFrequency, const FAudioBufferReadRef& InPhaseMod);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+	private:
+		FAudioBufferReadRef mFrequency;
+		FAudioBufferReadRef mPhaseMod;
+		FAudioBufferWriteRef AudioOutput;
+
+		DSPProcessing::FSineOscillator mOscillator;
+	};
+
+	class METASOUNDSAUDIOMATHUTILS_API FSineOscNode : public FNodeFacade
+	{
+	public:
+		FSineOscNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FSineOscOperator>())
+		{
+		}
+	};
+
+} // namespace Metasound
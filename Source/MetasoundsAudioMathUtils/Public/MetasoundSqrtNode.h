@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,28 +14,25 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FSqrtOperator
 	//------------------------------------------------------------------------------------
-	class FSqrtOperator : public TExecutableOperator<FSqrtOperator>
+	struct FSqrtNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FSqrt;
+		static constexpr bool bIsStateless = true;
+		static constexpr bool bHasAntiAliasing = true;
+		static constexpr const TCHAR* NodeName = TEXT("Sqrt (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FSqrtOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		DSPProcessing::FSqrt SqrtDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOutputName();
+		static FVertexName GetAntiAliasingName();
+		static FVertexName GetLatencyName();
 	};
 
+	using FSqrtOperator = TUnaryAudioMathOperator<FSqrtNodeOp>;
+	using FSqrtStereoNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FSqrtNodeOp, 2>>;
+	using FSqrtQuadNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FSqrtNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FSqrtNode
 	//------------------------------------------------------------------------------------
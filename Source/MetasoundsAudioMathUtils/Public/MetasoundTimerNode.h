@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 
+#include "AudioMathEventChannels.h"
 #include "MetasoundBuilderInterface.h"
 #include "MetasoundDataReferenceCollection.h"
 #include "MetasoundExecutableOperator.h"
@@ -27,7 +28,7 @@ public:
 	static const FVertexInterface& GetVertexInterface();
 	static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-	FTimerNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn);
+	FTimerNodeOperator(const FOperatorSettings& InSettings, const FBuildOperatorParams& InParams, const FTriggerReadRef& InTriggerIn, const FString& InChannelName);
 
 	virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 	virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -35,12 +36,21 @@ public:
 	virtual FDataReferenceCollection GetOutputs() const override;
 
 	void Execute();
+	void Reset(const IOperator::FResetParams& InParams);
 
 private:
 	float SampleRate;
+	int32 BlockSize;
 	FTriggerReadRef TriggerIn;
 	FTimeWriteRef mTimeSeconds;
-	long mSampsSinceLastTrigger;
+	TDataWriteReference<TArray<FTime>> mIntervals;
+
+	// integer sample counts so long sessions don't drift
+	int64 mSampsSinceLastTrigger;
+	int64 mBlockStartSample;
+
+	// invalid unless the Channel input names a channel no other node writes to
+	FTimerEventWriter mEventWriter;
 };
 
 class METASOUNDSAUDIOMATHUTILS_API FTimerNode : public FNodeFacade
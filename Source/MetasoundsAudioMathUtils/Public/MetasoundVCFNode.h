@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CytomicSVF.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 #include "MetasoundFacade.h"
@@ -37,6 +38,7 @@ namespace Metasound
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
 
 		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
 
 		void Init();
 
@@ -53,6 +55,44 @@ namespace Metasound
 
 	};
 
+	//------------------------------------------------------------------------------------
+	// TMultichannelVCFOperator
+	//------------------------------------------------------------------------------------
+	// One input, output and filter per channel, with cutoff, Q and filter type shared by all channels (see
+	// MetasoundMultichannelAudioMathOperator.h).
+	template<int32 NumChannels>
+	class TMultichannelVCFOperator : public TExecutableOperator<TMultichannelVCFOperator<NumChannels>>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		TMultichannelVCFOperator(const FOperatorSettings& InSettings, const TArray<FAudioBufferReadRef>& InAudioInputs, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, const FEnumVCFFilterTypeReadRef& InFilterType);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+		void Reset(const IOperator::FResetParams& InParams);
+
+		void Init();
+
+	private:
+		static FVertexName GetInputName(const int32 InChannel);
+		static FVertexName GetOutputName(const int32 InChannel);
+
+		TArray<FAudioBufferReadRef> AudioInputs;
+		TArray<FAudioBufferWriteRef> AudioOutputs;
+
+		FAudioBufferReadRef	 mInVCFCutoff;
+		FAudioBufferReadRef	 mInVCFQ;
+
+		DSPProcessing::CytomicSVF mCytomicSVFs[NumChannels];
+
+		FEnumVCFFilterTypeReadRef mFilterType;
+	};
+
 	//------------------------------------------------------------------------------------
 	// FVCFNode
 	//------------------------------------------------------------------------------------
@@ -66,4 +106,7 @@ namespace Metasound
 
 		}
 	};
+
+	using FVCFStereoNode = TAudioMathNode<TMultichannelVCFOperator<2>>;
+	using FVCFQuadNode = TAudioMathNode<TMultichannelVCFOperator<4>>;
 }
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathOperator.h"
+#include "MetasoundMultichannelAudioMathOperator.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -12,28 +14,25 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FWrapOperator
 	//------------------------------------------------------------------------------------
-	class FWrapOperator : public TExecutableOperator<FWrapOperator>
+	struct FWrapNodeOp
 	{
-	public:
+		using FProcessor = DSPProcessing::FWrap;
+		static constexpr bool bIsStateless = true;
+		static constexpr bool bHasAntiAliasing = true;
+		static constexpr const TCHAR* NodeName = TEXT("Wrap (Audio)");
+
 		static const FNodeClassMetadata& GetNodeInfo();
 		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
-
-		FWrapOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
-
-		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
-		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
-
-		void Execute();
-
-	private:
-		FAudioBufferReadRef	 AudioInput;
-		FAudioBufferWriteRef AudioOutput;
-
-		DSPProcessing::FWrap WrapDSPProcessor;
-
+		static FVertexName GetInputName();
+		static FVertexName GetOutputName();
+		static FVertexName GetAntiAliasingName();
+		static FVertexName GetLatencyName();
 	};
 
+	using FWrapOperator = TUnaryAudioMathOperator<FWrapNodeOp>;
+	using FWrapStereoNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FWrapNodeOp, 2>>;
+	using FWrapQuadNode = TAudioMathNode<TMultichannelUnaryAudioMathOperator<FWrapNodeOp, 4>>;
+
 	//------------------------------------------------------------------------------------
 	// FWrapNode
 	//------------------------------------------------------------------------------------
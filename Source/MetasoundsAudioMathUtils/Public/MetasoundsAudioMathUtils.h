@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+METASOUNDSAUDIOMATHUTILS_API DECLARE_LOG_CATEGORY_EXTERN(LogMetasoundsAudioMathUtils, Log, All);
+
 class METASOUNDSAUDIOMATHUTILS_API FMetasoundsAudioMathUtilsModule : public IModuleInterface
 {
 public:
@@ -0,0 +1,100 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace DSPProcessing
+{
+	// Upsamples by 2 with a halfband FIR. Only the odd taps of a halfband are non-zero (bar the centre tap, 0.5),
+	// so the even output phase is a short FIR and the odd phase is the delayed input.
+	class FHalfbandUpsampler
+	{
+	public:
+		// InHalfLength K gives a 4K - 1 tap filter. Allocates, call before processing.
+		void Init(const int32 InHalfLength, const int32 InMaxNumInputSamples);
+		void Reset();
+
+		// Writes 2 * InNumSamples samples to OutBuffer.
+		void Process(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+		// Group delay in output samples.
+		int32 GetLatency() const { return 2 * mHalfLength - 1; }
+
+	private:
+		int32 mHalfLength = 0;
+		TArray<float> mTaps;		// 2K polyphase taps, scaled by 2 for the zero stuffing
+		TArray<float> mHistory;		// 2K - 1 previous inputs followed by the current block
+		TArray<float> mEvenPhase;
+	};
+
+	// Halfband lowpass then decimation by 2, computing only the kept outputs.
+	class FHalfbandDownsampler
+	{
+	public:
+		void Init(const int32 InHalfLength, const int32 InMaxNumOutputSamples);
+		void Reset();
+
+		// Reads 2 * InNumSamples samples from InBuffer, writes InNumSamples to OutBuffer.
+		void Process(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+		// Group delay in input samples.
+		int32 GetLatency() const { return 2 * mHalfLength - 1; }
+
+	private:
+		int32 mHalfLength = 0;
+		TArray<float> mTaps;
+		TArray<float> mEvenHistory;	// 2K - 1 previous even inputs followed by this block's
+		TArray<float> mOddHistory;	// K previous odd inputs followed by this block's
+	};
+
+	// 1x, 2x or 4x oversampling around a nonlinear stage, as cascaded halfband stages:
+	//   float* Oversampled = Oversampler.Upsample(In, NumSamples);
+	//   Kernel.ProcessAudioBuffer(Oversampled, Oversampled, Oversampler.GetNumOversampledSamples(NumSamples));
+	//   Oversampler.Downsample(Out, NumSamples);
+	// The 2x stage carries the steep filter. The 4x stage only has to keep its images out of the band the 2x
+	// stage passes, so it uses a much shorter one.
+	class FOversampler
+	{
+	public:
+		static constexpr int32 MaxFactor = 4;
+
+		// Allocates for the largest factor so SetFactor never does.
+		void Init(const int32 InMaxNumSamples);
+		void Reset();
+
+		// 1, 2 or 4. Clears the filter state when the factor changes.
+		void SetFactor(const int32 InFactor);
+		int32 GetFactor() const { return mFactor; }
+
+		int32 GetNumOversampledSamples(const int32 InNumSamples) const { return InNumSamples * mFactor; }
+
+		// Added delay in base rate samples, fractional for 4x.
+		float GetLatencyInSamples() const;
+
+		// Returns the internal oversampled block, which the caller may process in place.
+		float* Upsample(const float* InBuffer, const int32 InNumSamples);
+
+		// Repeats each sample mFactor times, for operands of a nonlinear stage that are control-like and would
+		// only pick up filter ringing. Returns a separate internal block.
+		const float* HoldOperand(const float* InBuffer, const int32 InNumSamples);
+
+		// Filters and decimates the block returned by Upsample.
+		void Downsample(float* OutBuffer, const int32 InNumSamples);
+
+	private:
+		static constexpr int32 FirstStageHalfLength = 16;	// 63 taps, ~0.42 passband of the 2x rate
+		static constexpr int32 SecondStageHalfLength = 6;	// 23 taps, passband only needs to cover the 2x stage's
+
+		int32 mFactor = 1;
+
+		FHalfbandUpsampler mUpsamplers[2];
+		FHalfbandDownsampler mDownsamplers[2];
+
+		TArray<float> mOversampled;
+		TArray<float> mIntermediate;
+		TArray<float> mOperand;
+	};
+
+} // namespace DSPProcessing
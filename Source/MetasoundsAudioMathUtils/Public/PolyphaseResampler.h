@@ -0,0 +1,86 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace DSPProcessing
+{
+	// Windowed sinc interpolation table, one 16 tap filter per fractional phase.
+	class FPolyphaseFilterTable
+	{
+	public:
+		static constexpr int32 NumTaps = 16;
+		static constexpr int32 PhaseBits = 9;
+		static constexpr int32 NumPhases = 1 << PhaseBits;
+
+		// InCutoff is a fraction of the input Nyquist, lowered below 1 to band limit when reading faster than
+		// real time. Allocates and evaluates NumPhases * NumTaps windowed sincs, keep it off the audio thread
+		// where possible.
+		void Design(const float InCutoff);
+
+		float GetCutoff() const { return mCutoff; }
+
+		// NumTaps taps for InPhase in [0, NumPhases), 16 byte aligned
+		const float* GetPhase(const int32 InPhase) const { return &mTaps[InPhase * NumTaps]; }
+
+	private:
+		float mCutoff = 0.0f;
+		TArray<float> mTaps;
+	};
+
+	// Reads a live input stream at an arbitrary ratio (input samples per output sample) with band limited
+	// interpolation, e.g. for varispeed, Doppler or tape stop effects. Input is written into a ring of about
+	// 1.4 seconds at 48kHz. The read position is a 32.32 fixed point sample index so its increment never drifts.
+	//
+	// Both ends of the ring are clamped: at ratios above 1 the reader catches up with the newest input and holds
+	// there, at ratios below 1 it falls behind until it reaches the oldest input the ring keeps.
+	class FPolyphaseResampler
+	{
+	public:
+		static constexpr int32 RingBits = 16;
+		static constexpr int32 RingSize = 1 << RingBits;
+
+		// Delay between writing a sample and reading it at ratio 1.
+		static constexpr int32 Latency = FPolyphaseFilterTable::NumTaps / 2;
+
+		FPolyphaseResampler();
+
+		void Reset();
+
+		// Designs the resampler's own table for InCutoff, see FPolyphaseFilterTable::Design, and reads through it
+		// from the next block.
+		void SetCutoff(const float InCutoff);
+		float GetCutoff() const { return mActiveTable->GetCutoff(); }
+
+		// Reads through a table owned elsewhere, e.g. one designed by a TAsyncCoefficientDesigner, until the next
+		// SetFilterTable or SetCutoff. InTable must outlive its use; nullptr returns to the resampler's own table.
+		void SetFilterTable(const FPolyphaseFilterTable* InTable);
+
+		// Cutoff that keeps reading at InRatio free of aliasing.
+		static float GetCutoffForRatio(const float InRatio);
+
+		// Writes InNumSamples of input and reads InNumSamples of output. InBuffer may be OutBuffer.
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InRatio, const int32 InNumSamples);
+		void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InRatio, const int32 InNumSamples);
+
+	private:
+		void Write(const float* InBuffer, const int32 InNumSamples);
+		float ReadSample();
+		void ClampReadPosition();
+
+		static uint64 RatioToIncrement(const float InRatio);
+
+		FPolyphaseFilterTable mTable;
+		const FPolyphaseFilterTable* mActiveTable = &mTable;
+
+		// RingSize samples followed by a copy of the first NumTaps, so every read window is contiguous
+		TArray<float> mRing;
+
+		// total samples written, and the 32.32 position of the next read in the same units
+		uint64 mNumWritten = 0;
+		uint64 mReadPosition = 0;
+	};
+
+} // namespace DSPProcessing